@@ -5,23 +5,50 @@
 #ifndef ANALYSEURLOGS_H
 #define ANALYSEURLOGS_H
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
+#include "CardinalitesVues.h"
+#include "ClassementPopularite.h"
+#include "ColonnesLogs.h"
+#include "ComptageApproximatif.h"
 #include "GestionnaireFilms.h"
 #include "GestionnaireUtilisateurs.h"
 #include "LigneLog.h"
+#include "StatistiquesChargement.h"
+#include "TendancesFilms.h"
 #include "Tests.h"
 
-/// Classe contenant la liste des entrées du log pour en analyser les tendances pertinentes.
+/// Classe contenant la liste des entrées du log pour en analyser les tendances pertinentes. En mode approximatif, les
+/// entrées ne sont pas conservées: seuls le nombre de vues par film et les films les plus populaires sont estimés, en
+/// mémoire fixe; les autres statistiques et l'accès aux logs se comportent comme pour un analyseur vide.
 class AnalyseurLogs
 {
 public:
     // Opérations d'ajout de logs
     bool chargerDepuisFichier(const std::string& nomFichier, GestionnaireUtilisateurs& gestionnaireUtilisateurs,
                               GestionnaireFilms& gestionnaireFilms);
+    bool chargerDepuisFichierMappe(const std::string& nomFichier, GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                   GestionnaireFilms& gestionnaireFilms,
+                                   StatistiquesChargement* statistiques = nullptr);
+    bool chargerDepuisFichierParallele(const std::string& nomFichier,
+                                       GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                       GestionnaireFilms& gestionnaireFilms, std::size_t nombreThreads = 0,
+                                       StatistiquesChargement* statistiques = nullptr);
+    bool ajouterLignesDepuisTexte(std::string_view texte, const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                  const GestionnaireFilms& gestionnaireFilms);
     bool creerLigneLog(const std::string& timestamp, const std::string& idUtilisateur, const std::string& nomFilm,
                        GestionnaireUtilisateurs& gestionnaireUtilisateurs, GestionnaireFilms& gestionnaireFilms);
-    void ajouterLigneLog(const LigneLog& ligneLog);
+    bool ajouterLigneLog(const LigneLog& ligneLog);
+    bool ajouterLignesLog(const std::vector<LigneLog>& lignesLog);
+    void effacer();
+
+    // Accès aux logs
+    std::size_t getNombreLignesLog() const;
+    LigneLog getLigneLog(std::size_t index) const;
 
     // Statistiques 
     int getNombreVuesFilm(const Film* film) const;
@@ -29,11 +56,66 @@ public:
     std::vector<std::pair<const Film*, int>> getNFilmsPlusPopulaires(std::size_t nombre) const;
     int getNombreVuesPourUtilisateur(const Utilisateur* utilisateur) const;
     std::vector<const Film*> getFilmsVusParUtilisateur(const Utilisateur* utilisateur) const;
+    int getNombreVuesRealisateur(std::string_view realisateur, const GestionnaireFilms& gestionnaireFilms) const;
+    std::vector<std::pair<ChaineInternee, int>> getNRealisateursPlusPopulaires(std::size_t nombre) const;
+
+    // Statistiques sur un intervalle de temps [debut, fin), en secondes depuis l'époque Unix
+    int getNombreVuesFilm(const Film* film, std::int64_t debut, std::int64_t fin) const;
+    std::vector<std::pair<const Film*, int>> getNFilmsPlusPopulaires(std::size_t nombre, std::int64_t debut,
+                                                                     std::int64_t fin) const;
+    int getNombreVuesPourUtilisateur(const Utilisateur* utilisateur, std::int64_t debut, std::int64_t fin) const;
+    std::vector<const Film*> getFilmsVusParUtilisateur(const Utilisateur* utilisateur, std::int64_t debut,
+                                                       std::int64_t fin) const;
+
+    // Mode approximatif en mémoire bornée
+    bool activerModeApproximatif(double erreurRelative, double probabiliteEchec, std::size_t nombreFilmsSuivis);
+    bool estApproximatif() const;
+
+    // Nombres estimés de spectateurs et de films distincts
+    bool activerCardinalites(std::uint8_t precision);
+    void desactiverCardinalites();
+    std::int64_t getNombreSpectateursDistincts(const Film* film) const;
+    std::int64_t getNombreFilmsDistincts(const Utilisateur* utilisateur) const;
+    std::int64_t getNombreSpectateursDistincts(Pays pays) const;
+    const HyperLogLog* getEsquisseSpectateurs(const Film* film) const;
+    const HyperLogLog* getEsquisseFilms(const Utilisateur* utilisateur) const;
+    const HyperLogLog* getEsquisseSpectateurs(Pays pays) const;
+
+    // Tendances sur une fenêtre glissante se terminant au log le plus récent
+    bool activerTendances(std::int64_t dureeFenetre);
+    void desactiverTendances();
+    const Film* getFilmTendance() const;
+    std::vector<std::pair<const Film*, int>> getNFilmsTendance(std::size_t nombre) const;
 
 private:
-    std::vector<LigneLog> logs_;
-    std::unordered_map<const Film*, int> vuesFilms_;
+    std::vector<std::pair<const Film*, int>> getNFilmsPlusPopulaires(const ClassementPopularite& classement,
+                                                                     std::size_t nombre) const;
+    int getNombreVuesPourUtilisateur(const Utilisateur* utilisateur, const TrancheLogs& tranche) const;
+    std::vector<const Film*> getFilmsVusParUtilisateur(const Utilisateur* utilisateur,
+                                                       const TrancheLogs& tranche) const;
+
+    EntreeLog creerEntreeLog(std::int64_t timestamp, const Utilisateur* utilisateur, const Film* film);
+    void ajouterEntreesLog(std::vector<EntreeLog> entreesLog);
+    void comptabiliserEntreeLog(const EntreeLog& entreeLog);
+    void comptabiliserEntreeLogApproximative(const EntreeLog& entreeLog);
+
+    ColonnesLogs logs_;
+    ClassementPopularite classementFilms_; // Nombre de vues et classement par indice de film
+    std::vector<int> vuesUtilisateurs_; // Nombre de vues par indice d'utilisateur
+    std::vector<std::vector<std::uint32_t>> filmsVusUtilisateurs_; // Indices triés des films vus par utilisateur
+    std::optional<TendancesFilms> tendances_; // Présent seulement si les tendances sont activées
+    std::optional<CompteurVuesApproximatif> compteurApproximatif_; // Présent seulement en mode approximatif
+    std::optional<CardinalitesVues> cardinalites_; // Présent seulement si les cardinalités sont activées
+
+    // Tables qui associent les indices des entrées du log aux utilisateurs et aux films. L'indice d'un élément est son
+    // identifiant dense, sauf s'il entre en conflit avec un élément d'un autre gestionnaire (table de débordement).
+    std::vector<const Utilisateur*> utilisateurs_;
+    std::unordered_map<const Utilisateur*, std::uint32_t> debordementUtilisateurs_;
+    std::vector<const Film*> films_;
+    std::unordered_map<const Film*, std::uint32_t> debordementFilms_;
 
+    friend class IngestionLogs; // Pour l'ajout de lots dont l'horodatage est déjà converti
+    friend class Instantane; // Pour la sauvegarde binaire
     friend double Tests::testAnalyseurLogs(); // Pour les tests
 };
 
@@ -0,0 +1,23 @@
+/// Mesures de performance.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#define BENCHMARKS_ACTIFS false
+
+namespace Benchmarks
+{
+    void benchmarkAll();
+    void benchmarkLignesLog();
+    void benchmarkTendances();
+    void benchmarkEntrepot();
+    void benchmarkIndexChaines();
+    void benchmarkRequetesFilms();
+    void benchmarkRechercheTitres();
+    void benchmarkAudienceUtilisateurs();
+    void benchmarkIngestionLogs();
+} // namespace Benchmarks
+
+#endif // BENCHMARKS_H
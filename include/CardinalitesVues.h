@@ -0,0 +1,42 @@
+/// Nombre estimé de spectateurs et de films distincts.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef CARDINALITESVUES_H
+#define CARDINALITESVUES_H
+
+#include <cstdint>
+#include <vector>
+#include "Film.h"
+#include "HyperLogLog.h"
+#include "LigneLog.h"
+#include "Pays.h"
+#include "Utilisateur.h"
+
+/// Classe qui maintient une esquisse HyperLogLog de taille fixe par clé: les utilisateurs distincts de chaque film,
+/// les films distincts de chaque utilisateur et les utilisateurs distincts de chaque pays. Les esquisses sont rangées
+/// selon les indices propres à l'analyseur, mais les clés qui y sont ajoutées sont les identifiants attribués par les
+/// gestionnaires (Film::indice et Utilisateur::indice), qui ne dépendent pas de l'ordre dans lequel un analyseur a vu
+/// les logs. Les esquisses d'analyseurs couvrant des partitions d'un log se fusionnent donc, pourvu que leurs logs
+/// référencent les mêmes gestionnaires: deux gestionnaires distincts peuvent attribuer le même identifiant.
+class CardinalitesVues
+{
+public:
+    explicit CardinalitesVues(std::uint8_t precision);
+
+    void comptabiliserEntreeLog(const EntreeLog& entreeLog, const Utilisateur* utilisateur, const Film* film);
+    void effacer();
+
+    std::uint8_t getPrecision() const;
+    const HyperLogLog* getSpectateursFilm(std::uint32_t indiceFilm) const;
+    const HyperLogLog* getFilmsUtilisateur(std::uint32_t indiceUtilisateur) const;
+    const HyperLogLog* getSpectateursPays(Pays pays) const;
+
+private:
+    std::uint8_t precision_;
+    std::vector<HyperLogLog> spectateursFilms_; // Par indice de film
+    std::vector<HyperLogLog> filmsUtilisateurs_; // Par indice d'utilisateur
+    std::vector<HyperLogLog> spectateursPays_; // Par pays
+};
+
+#endif // CARDINALITESVUES_H
@@ -0,0 +1,106 @@
+/// Catalogue de films lisible par plusieurs threads pendant ses modifications.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef CATALOGUECONCURRENT_H
+#define CATALOGUECONCURRENT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Film.h"
+#include "GestionnaireFilms.h"
+
+/// Classe qui publie des versions immuables d'un gestionnaire de films. Les lecteurs obtiennent la version courante
+/// sans verrou et la gardent tant que leur Lecture existe, même si des versions plus récentes sont publiées entre-temps.
+/// Les écrivains, sérialisés entre eux par un mutex, modifient une copie de la version courante puis la publient.
+///
+/// Les anciennes versions sont libérées par époques: chaque lecture active affiche dans un emplacement l'époque
+/// courante à son début, et une version retirée à l'époque e n'est détruite qu'une fois qu'aucune lecture active n'a
+/// d'époque inférieure ou égale à e. Les pointeurs vers les films d'une version restent donc valides jusqu'à la fin de
+/// la Lecture qui les a obtenus.
+class CatalogueConcurrent
+{
+public:
+    static constexpr std::size_t nombreEmplacements = 64; // Nombre maximal de lectures simultanées
+
+    /// Accès en lecture à une version du catalogue, qui reste valide et inchangée jusqu'à la destruction de l'objet.
+    class Lecture
+    {
+    public:
+        ~Lecture();
+        Lecture(const Lecture&) = delete;
+        Lecture& operator=(const Lecture&) = delete;
+
+        const GestionnaireFilms& operator*() const;
+        const GestionnaireFilms* operator->() const;
+
+    private:
+        friend class CatalogueConcurrent;
+        Lecture(std::atomic<std::uint64_t>& emplacement, const GestionnaireFilms* version);
+
+        std::atomic<std::uint64_t>& emplacement_;
+        const GestionnaireFilms* version_;
+    };
+
+    explicit CatalogueConcurrent(GestionnaireFilms films = GestionnaireFilms());
+    ~CatalogueConcurrent();
+    CatalogueConcurrent(const CatalogueConcurrent&) = delete;
+    CatalogueConcurrent& operator=(const CatalogueConcurrent&) = delete;
+
+    Lecture lire() const;
+
+    template <typename Fonction>
+    bool modifier(Fonction fonction);
+    bool ajouterFilm(const Film& film);
+    bool supprimerFilm(std::string_view nomFilm);
+
+    std::size_t getNombreVersionsRetirees() const;
+
+private:
+    static constexpr std::uint64_t emplacementLibre = std::numeric_limits<std::uint64_t>::max();
+
+    /// Emplacement d'une lecture, seul sur sa ligne de cache pour que les lecteurs ne se ralentissent pas entre eux.
+    struct alignas(64) Emplacement
+    {
+        std::atomic<std::uint64_t> epoque{emplacementLibre};
+    };
+
+    void publier(std::unique_ptr<GestionnaireFilms> version);
+    void recupererVersions();
+
+    std::atomic<const GestionnaireFilms*> versionCourante_;
+    std::atomic<std::uint64_t> epoque_{1};
+    mutable std::array<Emplacement, nombreEmplacements> emplacements_;
+
+    mutable std::mutex mutexEcriture_;
+    // Versions remplacées avec l'époque de leur retrait, en ordre croissant d'époque
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<const GestionnaireFilms>>> versionsRetirees_;
+};
+
+/// Applique une modification à une copie de la version courante et publie la copie si elle a changé. Les lecteurs ne
+/// voient jamais une modification partielle, donc grouper plusieurs changements dans une même modification évite aussi
+/// de copier le catalogue pour chacun.
+/// \param fonction La modification, appelée avec une référence à la copie. Elle retourne false si elle n'a rien changé.
+/// \return         La valeur retournée par la modification.
+template <typename Fonction>
+bool CatalogueConcurrent::modifier(Fonction fonction)
+{
+    std::lock_guard verrou(mutexEcriture_);
+    auto version = std::make_unique<GestionnaireFilms>(*versionCourante_.load());
+    if (!fonction(*version))
+    {
+        return false;
+    }
+    publier(std::move(version));
+    return true;
+}
+
+#endif // CATALOGUECONCURRENT_H
@@ -0,0 +1,54 @@
+/// Chaînes de caractères internées.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef CHAINEINTERNEE_H
+#define CHAINEINTERNEE_H
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/// Classe qui désigne une chaîne conservée une seule fois dans un réservoir partagé par tout le programme. Toutes les
+/// chaînes internées de même contenu partagent la même copie et le même identifiant dense, attribué en ordre
+/// d'internement, ce qui permet de les comparer et de les indexer sans comparer de caractères. Le réservoir ne libère
+/// jamais ses chaînes: il est destiné à un ensemble restreint de valeurs très répétées, comme les réalisateurs. Les
+/// constructeurs qui internent sont donc explicites, et une simple recherche passe par trouver(), qui n'ajoute rien.
+/// L'internement peut se faire de plusieurs threads à la fois.
+class ChaineInternee
+{
+public:
+    ChaineInternee();
+    explicit ChaineInternee(std::string_view chaine);
+    explicit ChaineInternee(const std::string& chaine);
+    explicit ChaineInternee(const char* chaine);
+
+    static std::optional<ChaineInternee> trouver(std::string_view chaine);
+    static std::uint32_t getNombreChaines();
+
+    const std::string& get() const;
+    std::uint32_t getIdentifiant() const;
+
+private:
+    /// Chaîne conservée par le réservoir, avec son identifiant.
+    struct Entree
+    {
+        std::string chaine;
+        std::uint32_t identifiant;
+    };
+
+    struct Reservoir;
+
+    static Reservoir& getReservoir();
+    static const Entree* interner(std::string_view chaine);
+
+    const Entree* entree_;
+};
+
+bool operator==(const ChaineInternee& chaine1, const ChaineInternee& chaine2);
+bool operator!=(const ChaineInternee& chaine1, const ChaineInternee& chaine2);
+std::ostream& operator<<(std::ostream& outputStream, const ChaineInternee& chaine);
+
+#endif // CHAINEINTERNEE_H
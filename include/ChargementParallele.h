@@ -0,0 +1,82 @@
+/// Interprétation parallèle des lignes d'un fichier de données.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef CHARGEMENTPARALLELE_H
+#define CHARGEMENTPARALLELE_H
+
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Tokeniseur.h"
+
+/// Fonctions qui découpent un contenu en blocs alignés sur les fins de ligne et qui interprètent chaque bloc sur son
+/// propre thread. Les résultats sont rendus dans l'ordre des blocs pour que leur concaténation soit identique à une
+/// interprétation séquentielle.
+namespace ChargementParallele
+{
+    /// Struct contenant ce qu'un thread a extrait de son bloc, dans l'ordre des lignes.
+    /// \tparam Element Le type des éléments produits par l'interprétation d'une ligne.
+    template<typename Element>
+    struct ResultatBloc
+    {
+        std::vector<Element> elements;
+        std::vector<std::string_view> lignesInvalides;
+        std::size_t nombreLignes = 0;
+    };
+
+    std::size_t getNombreThreads(std::size_t nombreThreadsDemande);
+    std::vector<std::string_view> decouperEnBlocs(std::string_view contenu, std::size_t nombreBlocs);
+
+    /// Interprète toutes les lignes du contenu sur plusieurs threads.
+    /// \tparam Element         Le type des éléments produits.
+    /// \tparam Interpreteur    Foncteur bool(std::string_view ligne, std::vector<Element>& elements) qui retourne false
+    ///                         si la ligne est invalide. Chaque thread en reçoit sa propre copie, ce qui permet au
+    ///                         foncteur de conserver des tampons sans synchronisation.
+    /// \param contenu          Le contenu complet du fichier.
+    /// \param nombreThreads    Le nombre de threads à utiliser (0 pour le nombre de coeurs disponibles).
+    /// \param interpreteur     Le foncteur à appliquer à chaque ligne.
+    /// \return                 Un résultat par bloc, dans l'ordre du contenu.
+    template<typename Element, typename Interpreteur>
+    std::vector<ResultatBloc<Element>> interpreterLignes(std::string_view contenu, std::size_t nombreThreads,
+                                                         const Interpreteur& interpreteur)
+    {
+        std::vector<std::string_view> blocs = decouperEnBlocs(contenu, getNombreThreads(nombreThreads));
+        std::vector<ResultatBloc<Element>> resultats(blocs.size());
+
+        auto interpreterBloc = [&blocs, &resultats, &interpreteur](std::size_t indexBloc)
+        {
+            Interpreteur interpreteurLocal = interpreteur;
+            ResultatBloc<Element>& resultat = resultats[indexBloc];
+            std::string_view reste = blocs[indexBloc];
+            std::string_view ligne;
+            while (Tokeniseur::lireLigne(reste, ligne))
+            {
+                resultat.nombreLignes++;
+                if (!interpreteurLocal(ligne, resultat.elements))
+                {
+                    resultat.lignesInvalides.push_back(ligne);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(blocs.size());
+        for (std::size_t i = 1; i < blocs.size(); i++)
+        {
+            threads.emplace_back(interpreterBloc, i);
+        }
+        if (!blocs.empty())
+        {
+            interpreterBloc(0); // Le thread appelant traite le premier bloc
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return resultats;
+    }
+} // namespace ChargementParallele
+
+#endif // CHARGEMENTPARALLELE_H
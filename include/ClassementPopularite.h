@@ -0,0 +1,33 @@
+/// Classement des films par nombre de vues, maintenu à chaque vue.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef CLASSEMENTPOPULARITE_H
+#define CLASSEMENTPOPULARITE_H
+
+#include <cstdint>
+#include <vector>
+
+/// Classe qui conserve des éléments identifiés par un indice dense en ordre décroissant de nombre de vues. Les
+/// éléments de même nombre de vues forment un groupe contigu; une vue échange l'élément avec le premier de son groupe
+/// puis déplace la frontière du groupe, en O(1), et le retrait d'une vue fait l'inverse. Seuls les éléments ayant au
+/// moins une vue sont classés, et l'ordre entre éléments à égalité n'est pas spécifié.
+class ClassementPopularite
+{
+public:
+    void ajouterVue(std::uint32_t indice);
+    void retirerVue(std::uint32_t indice);
+    void effacer();
+
+    int getNombreVues(std::uint32_t indice) const;
+    const std::vector<int>& getVues() const;
+    const std::vector<std::uint32_t>& getOrdre() const;
+
+private:
+    std::vector<int> vues_; // Nombre de vues par indice
+    std::vector<std::uint32_t> ordre_; // Indices classés en ordre décroissant de vues
+    std::vector<std::size_t> positions_; // Position de chaque indice dans ordre_
+    std::vector<std::size_t> debutsGroupes_; // Première position des éléments ayant un nombre de vues donné
+};
+
+#endif // CLASSEMENTPOPULARITE_H
@@ -0,0 +1,59 @@
+/// Stockage en colonnes des entrées du log.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef COLONNESLOGS_H
+#define COLONNESLOGS_H
+
+#include <cstdint>
+#include <vector>
+#include "LigneLog.h"
+
+/// Classe qui offre une vue non propriétaire sur une tranche contiguë des colonnes du log. La vue reste valide tant
+/// que les colonnes d'origine ne sont pas modifiées.
+class TrancheLogs
+{
+public:
+    TrancheLogs(const std::int64_t* timestamps, const std::uint32_t* utilisateurs, const std::uint32_t* films,
+                std::size_t nombreEntrees);
+
+    std::size_t getNombreEntrees() const;
+    bool estVide() const;
+
+    const std::int64_t* getTimestamps() const;
+    const std::uint32_t* getUtilisateurs() const;
+    const std::uint32_t* getFilms() const;
+
+private:
+    const std::int64_t* timestamps_;
+    const std::uint32_t* utilisateurs_;
+    const std::uint32_t* films_;
+    std::size_t nombreEntrees_;
+};
+
+/// Classe qui conserve les entrées du log en ordre chronologique sous forme de trois colonnes contiguës (horodatages,
+/// utilisateurs et films). Un parcours qui ne lit qu'un champ ne charge ainsi que la colonne correspondante.
+class ColonnesLogs
+{
+public:
+    std::size_t getNombreEntrees() const;
+    bool estVide() const;
+    EntreeLog getEntree(std::size_t index) const;
+
+    const std::vector<std::int64_t>& getTimestamps() const;
+    const std::vector<std::uint32_t>& getUtilisateurs() const;
+    const std::vector<std::uint32_t>& getFilms() const;
+    TrancheLogs getTranche() const;
+    TrancheLogs getTranche(std::int64_t debut, std::int64_t fin) const;
+
+    void inserer(const EntreeLog& entreeLog);
+    void fusionner(const std::vector<EntreeLog>& entreesTriees);
+    void effacer();
+
+private:
+    std::vector<std::int64_t> timestamps_;
+    std::vector<std::uint32_t> utilisateurs_;
+    std::vector<std::uint32_t> films_;
+};
+
+#endif // COLONNESLOGS_H
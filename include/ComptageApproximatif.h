@@ -0,0 +1,97 @@
+/// Comptage approximatif des vues en mémoire bornée.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef COMPTAGEAPPROXIMATIF_H
+#define COMPTAGEAPPROXIMATIF_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// Esquisse Count-Min: une matrice de compteurs de profondeur d = ⌈ln(1/δ)⌉ et de largeur w ≥ e/ε, où chaque ligne
+/// associe une clé à un compteur par une fonction de hachage indépendante. L'estimation est le minimum des compteurs
+/// de la clé: elle ne sous-estime jamais et, après N ajouts, dépasse le compte réel de plus de εN avec une
+/// probabilité d'au plus δ. La mise à jour est conservatrice (seuls les compteurs égaux au minimum sont incrémentés),
+/// ce qui conserve ces garanties en réduisant l'erreur en pratique.
+class EsquisseCountMin
+{
+public:
+    EsquisseCountMin(double erreurRelative, double probabiliteEchec);
+
+    void ajouter(std::uint32_t cle);
+    int estimer(std::uint32_t cle) const;
+    void effacer();
+
+    std::size_t getLargeur() const;
+    std::size_t getProfondeur() const;
+    std::int64_t getNombreAjouts() const;
+
+private:
+    std::size_t getPosition(std::size_t ligne, std::uint32_t cle) const;
+
+    std::size_t largeur_; // Puissance de 2
+    unsigned decalage_; // 64 - log2(largeur_)
+    std::vector<std::uint64_t> multiplicateurs_; // Un multiplicateur impair par ligne
+    std::vector<std::uint64_t> additifs_;
+    std::vector<int> compteurs_; // Ligne par ligne
+    std::int64_t nombreAjouts_ = 0;
+};
+
+/// Résumé Space-Saving: au plus k clés suivies avec leur compte. Une clé non suivie remplace la clé de plus petit
+/// compte m et hérite du compte m + 1, avec une erreur m. Après N ajouts, le compte d'une clé suivie dépasse son
+/// compte réel d'au plus son erreur, elle-même au plus N/k, et toute clé dont le compte réel dépasse N/k est suivie.
+/// Les clés sont gardées dans un tas min indexé, en O(log k) par ajout.
+class ResumeSpaceSaving
+{
+public:
+    /// Clé suivie avec son compte, qui surestime le compte réel d'au plus l'erreur.
+    struct Element
+    {
+        std::uint32_t cle;
+        int compte;
+        int erreur;
+    };
+
+    explicit ResumeSpaceSaving(std::size_t capacite);
+
+    void ajouter(std::uint32_t cle);
+    const Element* trouver(std::uint32_t cle) const;
+    std::vector<Element> getPlusFrequents(std::size_t nombre) const;
+    void effacer();
+
+    std::size_t getCapacite() const;
+
+private:
+    void descendre(std::size_t position);
+    void remonter(std::size_t position);
+    void echanger(std::size_t position1, std::size_t position2);
+
+    std::size_t capacite_;
+    std::vector<Element> tas_; // Tas min selon le compte
+    std::unordered_map<std::uint32_t, std::size_t> positions_; // Position de chaque clé suivie dans tas_
+};
+
+/// Classe qui estime le nombre de vues par indice de film et les films les plus vus en mémoire fixe, indépendante du
+/// nombre de vues, en combinant une esquisse Count-Min et un résumé Space-Saving. Chaque estimation est le minimum
+/// des deux surestimations disponibles.
+class CompteurVuesApproximatif
+{
+public:
+    CompteurVuesApproximatif(double erreurRelative, double probabiliteEchec, std::size_t nombreFilmsSuivis);
+
+    void ajouterVue(std::uint32_t indice);
+    int estimerVues(std::uint32_t indice) const;
+    std::vector<std::pair<std::uint32_t, int>> getPlusVus(std::size_t nombre) const;
+    void effacer();
+
+    const EsquisseCountMin& getEsquisse() const;
+    const ResumeSpaceSaving& getResume() const;
+
+private:
+    EsquisseCountMin esquisse_;
+    ResumeSpaceSaving resume_;
+};
+
+#endif // COMPTAGEAPPROXIMATIF_H
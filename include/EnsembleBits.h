@@ -0,0 +1,110 @@
+/// Ensemble de positions représenté par des bits.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef ENSEMBLEBITS_H
+#define ENSEMBLEBITS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Classe qui représente un ensemble de positions denses par un bit par position, rangés dans des mots de 64 bits.
+/// L'union et l'intersection traitent 64 positions par opération, et le parcours visite les positions en ordre
+/// croissant en sautant directement d'un bit à un à l'autre. Les mots au-delà de la taille du vecteur sont nuls.
+class EnsembleBits
+{
+public:
+    /// Ajoute une position à l'ensemble.
+    /// \param position La position.
+    void ajouter(std::size_t position)
+    {
+        if (position / 64 >= mots_.size())
+        {
+            mots_.resize(position / 64 + 1);
+        }
+        mots_[position / 64] |= std::uint64_t{1} << (position % 64);
+    }
+
+    /// Retire une position de l'ensemble.
+    /// \param position La position.
+    void retirer(std::size_t position)
+    {
+        if (position / 64 < mots_.size())
+        {
+            mots_[position / 64] &= ~(std::uint64_t{1} << (position % 64));
+        }
+    }
+
+    /// Indique si une position fait partie de l'ensemble.
+    /// \param position La position.
+    /// \return         True si la position fait partie de l'ensemble.
+    bool contient(std::size_t position) const
+    {
+        return position / 64 < mots_.size() && (mots_[position / 64] >> (position % 64) & 1) != 0;
+    }
+
+    /// Remplace l'ensemble par son union avec un autre ensemble, mot par mot.
+    /// \param autre    L'autre ensemble.
+    void unir(const EnsembleBits& autre)
+    {
+        if (autre.mots_.size() > mots_.size())
+        {
+            mots_.resize(autre.mots_.size());
+        }
+        for (std::size_t i = 0; i < autre.mots_.size(); i++)
+        {
+            mots_[i] |= autre.mots_[i];
+        }
+    }
+
+    /// Remplace l'ensemble par son intersection avec un autre ensemble, mot par mot.
+    /// \param autre    L'autre ensemble.
+    void intersecter(const EnsembleBits& autre)
+    {
+        mots_.resize(std::min(mots_.size(), autre.mots_.size()));
+        for (std::size_t i = 0; i < mots_.size(); i++)
+        {
+            mots_[i] &= autre.mots_[i];
+        }
+    }
+
+    /// Applique une fonction à chaque position de l'ensemble, en ordre croissant.
+    /// \param fonction La fonction, appelée avec chaque position.
+    template <typename Fonction>
+    void pourChaque(Fonction fonction) const
+    {
+        for (std::size_t i = 0; i < mots_.size(); i++)
+        {
+            for (std::uint64_t mot = mots_[i]; mot != 0; mot &= mot - 1)
+            {
+                fonction(i * 64 + static_cast<std::size_t>(__builtin_ctzll(mot)));
+            }
+        }
+    }
+
+    /// Compte les positions de l'ensemble.
+    /// \return Le nombre de positions.
+    std::size_t compter() const
+    {
+        std::size_t nombre = 0;
+        for (std::uint64_t mot : mots_)
+        {
+            nombre += static_cast<std::size_t>(__builtin_popcountll(mot));
+        }
+        return nombre;
+    }
+
+    /// Indique si l'ensemble ne contient aucune position.
+    /// \return True si l'ensemble est vide.
+    bool estVide() const
+    {
+        return std::all_of(mots_.begin(), mots_.end(), [](std::uint64_t mot) { return mot == 0; });
+    }
+
+private:
+    std::vector<std::uint64_t> mots_;
+};
+
+#endif // ENSEMBLEBITS_H
@@ -0,0 +1,196 @@
+/// Stockage par blocs à adresses stables.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef ENTREPOTSTABLE_H
+#define ENTREPOTSTABLE_H
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Classe qui possède des éléments rangés de façon contiguë dans des blocs de taille fixe. Un élément ne se déplace
+/// jamais: son adresse reste valide jusqu'à sa destruction, y compris lorsque l'entrepôt est déplacé, ce qui permet
+/// aux index et à l'analyseur de logs de conserver des pointeurs bruts. Une seule allocation est faite par bloc et
+/// les emplacements libérés sont réutilisés; parcourir les éléments lit les blocs séquentiellement.
+/// \tparam T           Le type des éléments.
+/// \tparam tailleBloc  Le nombre d'éléments par bloc.
+template <typename T, std::size_t tailleBloc = 256>
+class EntrepotStable
+{
+public:
+    EntrepotStable() = default;
+    EntrepotStable(const EntrepotStable&) = delete; // La copie changerait les adresses des éléments
+    EntrepotStable& operator=(const EntrepotStable&) = delete;
+
+    /// Constructeur par déplacement: les blocs changent de propriétaire sans que les éléments ne bougent.
+    /// \param autre    L'entrepôt à déplacer, laissé vide.
+    EntrepotStable(EntrepotStable&& autre) noexcept { echanger(autre); }
+
+    /// Opérateur d'assignation par déplacement: les éléments actuels sont détruits avec l'entrepôt déplacé.
+    /// \param autre    L'entrepôt à déplacer.
+    /// \return         Référence à l'objet actuel.
+    EntrepotStable& operator=(EntrepotStable&& autre) noexcept
+    {
+        echanger(autre);
+        return *this;
+    }
+
+    ~EntrepotStable() { effacer(); }
+
+    /// Construit un élément dans un emplacement libre, en O(1) amorti.
+    /// \param arguments    Les arguments du constructeur de l'élément.
+    /// \return             Un pointeur vers l'élément, valide jusqu'à sa destruction.
+    template <typename... Arguments>
+    T* creer(Arguments&&... arguments)
+    {
+        Bloc* bloc;
+        std::size_t index;
+        if (!libres_.empty())
+        {
+            std::tie(bloc, index) = libres_.back();
+        }
+        else
+        {
+            if (emplacementsDistribues_ == blocs_.size() * tailleBloc)
+            {
+                ajouterBloc();
+            }
+            bloc = blocs_[emplacementsDistribues_ / tailleBloc].get();
+            index = emplacementsDistribues_ % tailleBloc;
+        }
+
+        // L'emplacement n'est retiré des emplacements libres qu'une fois l'élément construit
+        T* element = new (&bloc->emplacements[index]) T(std::forward<Arguments>(arguments)...);
+        if (!libres_.empty())
+        {
+            libres_.pop_back();
+        }
+        else
+        {
+            emplacementsDistribues_++;
+        }
+        bloc->occupes.set(index);
+        nombreElements_++;
+        return element;
+    }
+
+    /// Détruit un élément et libère son emplacement, en O(log nombre de blocs).
+    /// \param element  L'élément, qui doit appartenir à l'entrepôt.
+    void detruire(const T* element)
+    {
+        auto it = std::upper_bound(blocsParAdresse_.begin(), blocsParAdresse_.end(), element,
+                                   [](const T* element, const Bloc* bloc)
+                                   { return std::less<const void*>()(element, bloc); });
+        Bloc* bloc = *std::prev(it);
+        auto index = static_cast<std::size_t>(reinterpret_cast<const Emplacement*>(element) - bloc->emplacements);
+        element->~T();
+        bloc->occupes.reset(index);
+        libres_.emplace_back(bloc, index);
+        nombreElements_--;
+    }
+
+    /// Détruit tous les éléments et libère tous les blocs.
+    void effacer()
+    {
+        for (const auto& bloc : blocs_)
+        {
+            for (std::size_t i = 0; i < tailleBloc; i++)
+            {
+                if (bloc->occupes.test(i))
+                {
+                    std::launder(reinterpret_cast<T*>(&bloc->emplacements[i]))->~T();
+                    bloc->occupes.reset(i);
+                }
+            }
+        }
+        blocs_.clear();
+        blocsParAdresse_.clear();
+        libres_.clear();
+        emplacementsDistribues_ = 0;
+        nombreElements_ = 0;
+    }
+
+    /// Alloue d'avance les blocs nécessaires pour contenir un nombre donné d'éléments.
+    /// \param nombreElements   Le nombre total d'éléments prévu.
+    void reserver(std::size_t nombreElements)
+    {
+        // Chaque emplacement déjà distribué est soit occupé, soit libre et réutilisable
+        std::size_t blocsNecessaires =
+            (std::max(emplacementsDistribues_, nombreElements) + tailleBloc - 1) / tailleBloc;
+        blocs_.reserve(blocsNecessaires);
+        blocsParAdresse_.reserve(blocsNecessaires);
+        while (blocs_.size() < blocsNecessaires)
+        {
+            ajouterBloc();
+        }
+    }
+
+    /// Applique une fonction à chaque élément, bloc par bloc, dans l'ordre des emplacements.
+    /// \param fonction La fonction, appelée avec une référence constante à chaque élément.
+    template <typename Fonction>
+    void pourChaque(Fonction fonction) const
+    {
+        for (const auto& bloc : blocs_)
+        {
+            for (std::size_t i = 0; i < tailleBloc; i++)
+            {
+                if (bloc->occupes.test(i))
+                {
+                    fonction(*std::launder(reinterpret_cast<const T*>(&bloc->emplacements[i])));
+                }
+            }
+        }
+    }
+
+    /// Retourne le nombre d'éléments.
+    /// \return Le nombre d'éléments vivants.
+    std::size_t getNombreElements() const { return nombreElements_; }
+
+    /// Échange le contenu de deux entrepôts sans déplacer leurs éléments.
+    /// \param autre    L'autre entrepôt.
+    void echanger(EntrepotStable& autre) noexcept
+    {
+        std::swap(blocs_, autre.blocs_);
+        std::swap(blocsParAdresse_, autre.blocsParAdresse_);
+        std::swap(libres_, autre.libres_);
+        std::swap(emplacementsDistribues_, autre.emplacementsDistribues_);
+        std::swap(nombreElements_, autre.nombreElements_);
+    }
+
+private:
+    using Emplacement = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+    /// Bloc d'emplacements contigus avec l'état occupé ou libre de chacun.
+    struct Bloc
+    {
+        Emplacement emplacements[tailleBloc];
+        std::bitset<tailleBloc> occupes;
+    };
+
+    /// Alloue un nouveau bloc et l'insère dans l'index par adresse.
+    void ajouterBloc()
+    {
+        blocs_.push_back(std::unique_ptr<Bloc>(new Bloc)); // Sans initialiser les emplacements
+        Bloc* bloc = blocs_.back().get();
+        blocsParAdresse_.insert(std::upper_bound(blocsParAdresse_.begin(), blocsParAdresse_.end(), bloc,
+                                                 std::less<const Bloc*>()),
+                                bloc);
+    }
+
+    std::vector<std::unique_ptr<Bloc>> blocs_; // En ordre d'allocation
+    std::vector<Bloc*> blocsParAdresse_; // Pour retrouver le bloc d'un élément
+    std::vector<std::pair<Bloc*, std::size_t>> libres_; // Emplacements libérés, réutilisés en premier
+    std::size_t emplacementsDistribues_ = 0; // Emplacements neufs déjà utilisés, bloc par bloc
+    std::size_t nombreElements_ = 0;
+};
+
+#endif // ENTREPOTSTABLE_H
@@ -0,0 +1,38 @@
+/// Fichier projeté en mémoire en lecture seule.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef FICHIERMAPPE_H
+#define FICHIERMAPPE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/// Classe RAII qui projette un fichier complet en mémoire (mmap ou MapViewOfFile) afin de le lire sans copie.
+class FichierMappe
+{
+public:
+    // Fonctions membres spéciales
+    explicit FichierMappe(const std::string& nomFichier);
+    FichierMappe(const FichierMappe&) = delete;
+    FichierMappe& operator=(const FichierMappe&) = delete;
+    ~FichierMappe();
+
+    // Getters
+    bool estOuvert() const;
+    std::string_view getContenu() const;
+
+private:
+    void fermer();
+
+    const char* donnees_ = nullptr;
+    std::size_t taille_ = 0;
+    bool estOuvert_ = false;
+#ifdef _WIN32
+    void* fichier_ = nullptr;
+    void* projection_ = nullptr;
+#endif
+};
+
+#endif // FICHIERMAPPE_H
@@ -5,8 +5,10 @@
 #ifndef FILM_H
 #define FILM_H
 
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include "ChaineInternee.h"
 #include "Pays.h"
 
 /// Struct contenant les caractéristiques pour un film.
@@ -25,14 +27,17 @@ struct Film
         Romance,
         ScienceFiction
     };
+    static constexpr std::size_t nombreGenres = static_cast<std::size_t>(Genre::ScienceFiction) + 1;
 
     std::string nom;
     Genre genre;
     Pays pays;
-    std::string realisateur;
+    ChaineInternee realisateur; // Partagé par tous les films du même réalisateur
     int annee;
+    std::uint32_t indice = 0; // Identifiant dense attribué par le gestionnaire de films, réutilisé après suppression
 };
 
+bool estGenreValide(Film::Genre genre);
 std::string getGenreString(Film::Genre genre);
 std::ostream& operator<<(std::ostream& outputStream, const Film& film);
 
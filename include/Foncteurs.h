@@ -5,6 +5,7 @@
 #ifndef FONCTEURS_H
 #define FONCTEURS_H
 
+#include <memory>
 #include "LigneLog.h"
 
 /// Foncteur qui verifie si un film a ete produit dans un intervalle de dates (date debut et date fin).
@@ -45,6 +46,15 @@ public:
     {
         return ligneLog1.timestamp < ligneLog2.timestamp;
     }
+
+    /// Opérateur permettant d'utiliser le foncteur sur deux entrées compactes du log.
+    /// \param entreeLog1   Une des deux entrées à comparer.
+    /// \param entreeLog2   Une des deux entrées à comparer.
+    /// \return             Un bool représentant si l'horodatage de l'entrée de gauche est plus petit que celui de droite.
+    bool operator()(const EntreeLog& entreeLog1, const EntreeLog& entreeLog2) const
+    {
+        return entreeLog1.timestamp < entreeLog2.timestamp;
+    }
 };
 
 /// Foncteur qui compare les seconds elements de deux paires et qui retourne le resultat de cette comparaison.
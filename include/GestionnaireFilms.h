@@ -5,11 +5,19 @@
 #ifndef GESTIONNAIREFILMS_H
 #define GESTIONNAIREFILMS_H
 
-#include <memory>
+#include <array>
+#include <cstdint>
+#include <map>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
+#include "EnsembleBits.h"
+#include "EntrepotStable.h"
 #include "Film.h"
+#include "IndexChaines.h"
+#include "IndexTitres.h"
+#include "RequeteFilms.h"
+#include "VueFilms.h"
 
 /// Classe qui gère les informations de tous les films et qui conserve des filtres pour les rechercher rapidement.
 class GestionnaireFilms
@@ -26,23 +34,57 @@ public:
 
     // Opérations d'ajout et de suppression
     bool chargerDepuisFichier(const std::string& nomFichier);
+    bool chargerDepuisFichierParallele(const std::string& nomFichier, std::size_t nombreThreads = 0);
     bool ajouterFilm(const Film& film);
-    bool supprimerFilm(const std::string& nomFilm);
+    bool supprimerFilm(std::string_view nomFilm);
 
     // Getters
     std::size_t getNombreFilms() const;
-    const Film* getFilmParNom(const std::string& nom) const;
-    std::vector<const Film*> getFilmsParGenre(Film::Genre genre) const;
-    std::vector<const Film*> getFilmsParPays(Pays pays) const;
-    std::vector<const Film*> getFilmsEntreAnnees(int anneeDebut, int anneeFin);
+    const Film* getFilmParNom(std::string_view nom) const;
+    VueFilms getFilmsParGenre(Film::Genre genre) const;
+    VueFilms getFilmsParPays(Pays pays) const;
+    VueFilms getFilmsParRealisateur(std::string_view realisateur) const;
+    std::vector<const Film*> getFilmsEntreAnnees(int anneeDebut, int anneeFin) const;
+    std::vector<const Film*> rechercherFilms(const RequeteFilms& requete) const;
+    std::vector<const Film*> rechercherFilmsParPrefixe(std::string_view prefixe,
+                                                       std::size_t limite = IndexTitres::aucuneLimite) const;
+    std::vector<const Film*> rechercherFilmsParSousChaine(std::string_view sousChaine,
+                                                          std::size_t limite = IndexTitres::aucuneLimite) const;
 
 private:
-    std::vector<std::unique_ptr<Film>> films_; // Vecteur de pointeurs pour ne pas que les éléments des filtres
-                                               // deviennent invalidés lors d'un resize du vecteur
+    /// Positions d'un film dans les vecteurs de ses filtres, pour l'en retirer en temps constant.
+    struct PositionsFilm
+    {
+        std::size_t genre;
+        std::size_t pays;
+        std::size_t realisateur;
+        std::size_t annee;
+    };
 
-    std::unordered_map<std::string, const Film*> filtreNomFilms_;
-    std::unordered_map<Film::Genre, std::vector<const Film*>> filtreGenreFilms_;
-    std::unordered_map<Pays, std::vector<const Film*>> filtrePaysFilms_;
+    void effacer();
+    const Film* indexerFilm(const Film& film);
+    void retirerDuFiltre(std::vector<const Film*>& filtre, std::size_t PositionsFilm::*position, const Film* film);
+
+    EntrepotStable<Film> films_; // Adresses stables pour ne pas que les éléments des filtres deviennent invalidés
+
+    IndexChaines<const Film> filtreNomFilms_; // Clés pointant vers le nom de chaque film
+    std::array<std::vector<const Film*>, Film::nombreGenres> filtreGenreFilms_; // Indexé par genre
+    std::array<std::vector<const Film*>, nombrePays> filtrePaysFilms_; // Indexé par pays
+    std::vector<std::vector<const Film*>> filtreRealisateurFilms_; // Indexé par identifiant de réalisateur
+    std::map<int, std::vector<const Film*>> filtreAnneeFilms_; // En ordre croissant d'année
+    std::vector<PositionsFilm> positionsFilms_; // Par indice de film
+    IndexTitres indexTitres_; // Recherche par préfixe et par sous-chaîne du nom
+
+    // Ensembles des indices des films par valeur de critère, pour les requêtes sur plusieurs critères
+    std::vector<const Film*> filmsParIndice_; // Nul pour un indice sans film
+    EnsembleBits bitsFilms_; // Tous les films présents
+    std::array<EnsembleBits, Film::nombreGenres> bitsGenres_;
+    std::array<EnsembleBits, nombrePays> bitsPays_;
+    std::map<int, EnsembleBits> bitsAnnees_; // Seulement les années ayant au moins un film
+    std::uint32_t prochainIndice_ = 0; // Premier indice jamais attribué
+    std::vector<std::uint32_t> indicesLibres_; // Indices de films supprimés, attribués avant prochainIndice_
+
+    friend class Instantane; // Pour la sauvegarde binaire
 };
 
 #endif // GESTIONNAIREFILMS_H
\ No newline at end of file
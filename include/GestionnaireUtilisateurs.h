@@ -5,29 +5,62 @@
 #ifndef GESTIONNAIREUTILISATEURS_H
 #define GESTIONNAIREUTILISATEURS_H
 
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <map>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+#include "EntrepotStable.h"
+#include "IndexChaines.h"
+#include "Pays.h"
 #include "Utilisateur.h"
 
-/// Classe qui gère les informations de tous les utilisateurs.
+/// Classe qui gère les informations de tous les utilisateurs et qui conserve des filtres par pays et par âge pour les
+/// rechercher rapidement.
 class GestionnaireUtilisateurs
 {
 public:
+    // Fonctions membres spéciales
+    GestionnaireUtilisateurs() = default;
+    GestionnaireUtilisateurs(const GestionnaireUtilisateurs& other);
+    GestionnaireUtilisateurs(GestionnaireUtilisateurs&&) = default;
+    GestionnaireUtilisateurs& operator=(GestionnaireUtilisateurs other);
+
     // Surcharges d'opérateurs
     friend std::ostream& operator<<(std::ostream& outputStream,
                                     const GestionnaireUtilisateurs& gestionnaireUtilisateurs);
 
     // Opérations d'ajout et de suppression
     bool chargerDepuisFichier(const std::string& nomFichier);
+    bool chargerDepuisFichierParallele(const std::string& nomFichier, std::size_t nombreThreads = 0);
     bool ajouterUtilisateur(const Utilisateur& utilisateur);
-    bool supprimerUtilisateur(const std::string& idUtilisateur);
+    bool supprimerUtilisateur(std::string_view idUtilisateur);
 
     // Getters
     std::size_t getNombreUtilisateurs() const;
-    const Utilisateur* getUtilisateurParId(const std::string& id) const;
+    const Utilisateur* getUtilisateurParId(std::string_view id) const;
+    std::vector<const Utilisateur*> getUtilisateursParPays(Pays pays, int ageMin = std::numeric_limits<int>::min(),
+                                                           int ageMax = std::numeric_limits<int>::max()) const;
+    std::vector<const Utilisateur*> getUtilisateursEntreAges(int ageMin, int ageMax) const;
+    std::size_t getNombreUtilisateursParPays(Pays pays, int ageMin = std::numeric_limits<int>::min(),
+                                             int ageMax = std::numeric_limits<int>::max()) const;
+    std::map<int, std::size_t> getHistogrammeAges(Pays pays) const;
 
 private:
-    std::unordered_map<std::string, Utilisateur> utilisateurs_;
+    void effacer();
+    const Utilisateur* indexerUtilisateur(Utilisateur utilisateur);
+
+    EntrepotStable<Utilisateur> entrepotUtilisateurs_; // Adresses stables pour les pointeurs de l'analyseur de logs
+    IndexChaines<Utilisateur> utilisateurs_; // Clés pointant vers l'identifiant de chaque utilisateur
+    // Indexé par pays, puis en ordre croissant d'âge; la taille de chaque vecteur donne l'histogramme des âges
+    std::array<std::map<int, std::vector<const Utilisateur*>>, nombrePays> filtrePaysAgeUtilisateurs_;
+    std::vector<std::size_t> positionsUtilisateurs_; // Position dans le filtre par pays et par âge, par indice
+    std::uint32_t prochainIndice_ = 0; // Premier indice jamais attribué
+    std::vector<std::uint32_t> indicesLibres_; // Indices d'utilisateurs supprimés, attribués avant prochainIndice_
+
+    friend class Instantane; // Pour la sauvegarde binaire
 };
 
 #endif // GESTIONNAIREUTILISATEURS_H
@@ -0,0 +1,15 @@
+/// Conversion des horodatages des logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef HORODATAGE_H
+#define HORODATAGE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+bool convertirHorodatage(std::string_view texte, std::int64_t& secondes);
+std::string formaterHorodatage(std::int64_t secondes);
+
+#endif // HORODATAGE_H
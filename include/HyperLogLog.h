@@ -0,0 +1,36 @@
+/// Estimation du nombre d'éléments distincts en mémoire fixe.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include <cstdint>
+#include <vector>
+
+/// Esquisse HyperLogLog: m = 2^p registres d'un octet. Chaque clé est hachée sur 64 bits; les p premiers bits
+/// choisissent un registre qui garde la plus longue suite de zéros observée dans les bits restants. L'estimation a une
+/// erreur relative type d'environ 1,04/√m (3,25 % pour p = 10, soit 1 Kio) et deux esquisses de même précision se
+/// fusionnent exactement en prenant le maximum de chaque registre, comme si toutes leurs clés avaient été ajoutées à
+/// une seule esquisse.
+class HyperLogLog
+{
+public:
+    static constexpr std::uint8_t precisionMinimale = 4;
+    static constexpr std::uint8_t precisionMaximale = 16;
+
+    explicit HyperLogLog(std::uint8_t precision);
+
+    void ajouter(std::uint32_t cle);
+    bool fusionner(const HyperLogLog& autre);
+    double estimer() const;
+    void effacer();
+
+    std::uint8_t getPrecision() const;
+
+private:
+    std::uint8_t precision_;
+    std::vector<std::uint8_t> registres_;
+};
+
+#endif // HYPERLOGLOG_H
@@ -0,0 +1,194 @@
+/// Index de hachage à adressage ouvert par chaîne.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef INDEXCHAINES_H
+#define INDEXCHAINES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Classe qui associe des clés de type std::string_view à des pointeurs dans un seul tableau de cases, par sondage
+/// linéaire. Une recherche ne construit aucune std::string et ne suit aucun pointeur de noeud: les cases sondées sont
+/// contiguës et le hachage complet conservé dans chaque case évite la plupart des comparaisons de chaînes. Un retrait
+/// recule les cases suivantes de la même séquence de sondage plutôt que de laisser une pierre tombale.
+///
+/// L'index ne possède pas ses clés: chaque clé doit rester valide tant que son entrée est présente, typiquement parce
+/// qu'elle désigne un membre de l'élément pointé, dont l'adresse est stable.
+/// \tparam T   Le type des éléments pointés.
+template <typename T>
+class IndexChaines
+{
+public:
+    IndexChaines() = default;
+    IndexChaines(const IndexChaines&) = delete; // Une copie référencerait les clés des éléments de l'original
+    IndexChaines& operator=(const IndexChaines&) = delete;
+    IndexChaines(IndexChaines&&) noexcept = default;
+    IndexChaines& operator=(IndexChaines&&) noexcept = default;
+
+    /// Ajoute une entrée si la clé est absente, en O(1) amorti.
+    /// \param cle      La clé, qui doit rester valide tant que l'entrée est présente.
+    /// \param valeur   Le pointeur associé, non nul.
+    /// \return         True si l'entrée a été ajoutée, false si la clé était déjà présente.
+    bool inserer(std::string_view cle, T* valeur)
+    {
+        // Le facteur de charge reste d'au plus 1/2 pour garder de courtes séquences de sondage
+        if (2 * (taille_ + 1) > cases_.size())
+        {
+            redimensionner(std::max(cases_.size() * 2, capaciteMinimale));
+        }
+        std::size_t hachage = std::hash<std::string_view>()(cle);
+        std::size_t position = trouverPosition(cle, hachage);
+        if (cases_[position].valeur != nullptr)
+        {
+            return false;
+        }
+        cases_[position] = {hachage, cle, valeur};
+        taille_++;
+        return true;
+    }
+
+    /// Trouve l'élément associé à une clé, en O(1) en moyenne.
+    /// \param cle  La clé.
+    /// \return     Le pointeur associé, ou nullptr si la clé est absente.
+    T* trouver(std::string_view cle) const
+    {
+        if (taille_ == 0)
+        {
+            return nullptr;
+        }
+        return cases_[trouverPosition(cle, std::hash<std::string_view>()(cle))].valeur;
+    }
+
+    /// Retire l'entrée d'une clé en reculant les entrées suivantes de sa séquence de sondage.
+    /// \param cle  La clé.
+    /// \return     Le pointeur qui était associé, ou nullptr si la clé est absente.
+    T* retirer(std::string_view cle)
+    {
+        if (taille_ == 0)
+        {
+            return nullptr;
+        }
+        std::size_t trou = trouverPosition(cle, std::hash<std::string_view>()(cle));
+        T* valeur = cases_[trou].valeur;
+        if (valeur == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::size_t masque = cases_.size() - 1;
+        for (std::size_t position = (trou + 1) & masque; cases_[position].valeur != nullptr;
+             position = (position + 1) & masque)
+        {
+            // L'entrée recule dans le trou seulement si sa position idéale n'est pas entre le trou et elle
+            std::size_t ideale = cases_[position].hachage & masque;
+            bool idealeApresTrou = trou <= position ? trou < ideale && ideale <= position
+                                                    : trou < ideale || ideale <= position;
+            if (!idealeApresTrou)
+            {
+                cases_[trou] = cases_[position];
+                trou = position;
+            }
+        }
+        cases_[trou] = Case{};
+        taille_--;
+        return valeur;
+    }
+
+    /// Prépare l'index à contenir un nombre d'entrées sans redimensionnement.
+    /// \param nombreEntrees    Le nombre total d'entrées prévu.
+    void reserver(std::size_t nombreEntrees)
+    {
+        std::size_t capacite = capaciteMinimale;
+        while (capacite < 2 * nombreEntrees)
+        {
+            capacite *= 2;
+        }
+        if (capacite > cases_.size())
+        {
+            redimensionner(capacite);
+        }
+    }
+
+    /// Retire toutes les entrées en conservant la capacité.
+    void effacer()
+    {
+        std::fill(cases_.begin(), cases_.end(), Case{});
+        taille_ = 0;
+    }
+
+    /// Applique une fonction à chaque entrée, dans l'ordre des cases.
+    /// \param fonction La fonction, appelée avec la clé et le pointeur de chaque entrée.
+    template <typename Fonction>
+    void pourChaque(Fonction fonction) const
+    {
+        for (const Case& caseIndex : cases_)
+        {
+            if (caseIndex.valeur != nullptr)
+            {
+                fonction(caseIndex.cle, caseIndex.valeur);
+            }
+        }
+    }
+
+    /// Retourne le nombre d'entrées.
+    /// \return Le nombre d'entrées.
+    std::size_t getTaille() const { return taille_; }
+
+private:
+    static constexpr std::size_t capaciteMinimale = 16; // Puissance de 2
+
+    /// Entrée de l'index, vide lorsque valeur est nul.
+    struct Case
+    {
+        std::size_t hachage = 0;
+        std::string_view cle;
+        T* valeur = nullptr;
+    };
+
+    /// Sonde les cases à partir de la position idéale d'une clé.
+    /// \param cle      La clé.
+    /// \param hachage  Le hachage de la clé.
+    /// \return         La position de la clé, ou celle de la première case vide rencontrée si elle est absente.
+    std::size_t trouverPosition(std::string_view cle, std::size_t hachage) const
+    {
+        std::size_t masque = cases_.size() - 1;
+        std::size_t position = hachage & masque;
+        while (cases_[position].valeur != nullptr &&
+               (cases_[position].hachage != hachage || cases_[position].cle != cle))
+        {
+            position = (position + 1) & masque;
+        }
+        return position;
+    }
+
+    /// Replace toutes les entrées dans un tableau d'une nouvelle capacité, sans recalculer leur hachage.
+    /// \param capacite La nouvelle capacité, une puissance de 2 plus grande que deux fois le nombre d'entrées.
+    void redimensionner(std::size_t capacite)
+    {
+        std::vector<Case> anciennesCases(capacite);
+        std::swap(cases_, anciennesCases);
+        std::size_t masque = capacite - 1;
+        for (const Case& caseIndex : anciennesCases)
+        {
+            if (caseIndex.valeur != nullptr)
+            {
+                std::size_t position = caseIndex.hachage & masque;
+                while (cases_[position].valeur != nullptr)
+                {
+                    position = (position + 1) & masque;
+                }
+                cases_[position] = caseIndex;
+            }
+        }
+    }
+
+    std::vector<Case> cases_; // Capacité en puissance de 2, vide tant qu'aucune entrée n'a été ajoutée
+    std::size_t taille_ = 0;
+};
+
+#endif // INDEXCHAINES_H
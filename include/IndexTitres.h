@@ -0,0 +1,51 @@
+/// Index de recherche sur les titres de films.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef INDEXTITRES_H
+#define INDEXTITRES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Film.h"
+
+/// Classe qui permet de chercher des films par préfixe ou par sous-chaîne de leur titre, sans distinction entre
+/// majuscules et minuscules ASCII. Les préfixes sont cherchés dans un arbre ordonné des titres en minuscules, en
+/// O(log n + k). Les sous-chaînes d'au moins deux octets sont cherchées par n-grammes: chaque bigramme et chaque
+/// trigramme d'un titre possède la liste des rangs d'ajout des films qui le contiennent, et seuls les films de la plus
+/// courte liste des n-grammes demandés sont examinés. Les rangs sont propres à l'index et croissent à chaque ajout:
+/// les listes restent triées en y ajoutant simplement le rang à la fin, même quand le gestionnaire réutilise l'indice
+/// d'un film supprimé. Les films retirés sont ignorés jusqu'à ce que les listes soient compactées, une fois que les
+/// entrées périmées y sont plus nombreuses que les entrées valides; le compactage renumérote alors les rangs.
+class IndexTitres
+{
+public:
+    static constexpr std::size_t aucuneLimite = std::numeric_limits<std::size_t>::max();
+
+    void ajouter(const Film* film);
+    void retirer(const Film* film);
+    void effacer();
+    void remplacerFilms(const std::vector<const Film*>& filmsParIndice);
+
+    std::vector<const Film*> rechercherPrefixe(std::string_view prefixe, std::size_t limite = aucuneLimite) const;
+    std::vector<const Film*> rechercherSousChaine(std::string_view sousChaine,
+                                                  std::size_t limite = aucuneLimite) const;
+
+private:
+    void compacter();
+
+    std::vector<const Film*> films_; // Par rang d'ajout, nul si le film a été retiré
+    std::multimap<std::string, std::uint32_t> titres_; // Rangs des films par titre en minuscules
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> ngrammes_; // Rangs croissants par n-gramme
+    std::size_t nombreEntrees_ = 0; // Nombre total de rangs dans les listes de n-grammes
+    std::size_t nombreEntreesPerimees_ = 0; // Rangs de films retirés encore présents dans les listes
+    std::size_t nombreFilmsRetires_ = 0; // Rangs nuls de films_, y compris ceux des titres sans n-gramme
+};
+
+#endif // INDEXTITRES_H
@@ -0,0 +1,98 @@
+/// Ingestion concurrente de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef INGESTIONLOGS_H
+#define INGESTIONLOGS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AnalyseurLogs.h"
+#include "Film.h"
+#include "LigneLog.h"
+#include "Utilisateur.h"
+
+/// Classe qui permet à plusieurs threads producteurs d'ajouter des logs à un analyseur en même temps. Chaque
+/// producteur dépose ses logs, horodatage déjà converti, dans un des tampons choisi selon son thread, sous un verrou
+/// propre au tampon et donc rarement disputé. Un thread de fusion vide les tampons à intervalle régulier et ajoute
+/// chaque lot à l'analyseur en une seule passe, ce qui garde les logs de l'analyseur en ordre chronologique.
+///
+/// L'analyseur ne doit pas être utilisé directement tant que l'ingestion existe: consulter() y donne accès entre deux
+/// fusions, et vider() garantit que tous les logs déjà déposés y ont été ajoutés.
+class IngestionLogs
+{
+public:
+    explicit IngestionLogs(AnalyseurLogs& analyseurLogs, std::size_t nombreTampons = 0,
+                           std::chrono::milliseconds intervalle = std::chrono::milliseconds(10));
+    ~IngestionLogs();
+    IngestionLogs(const IngestionLogs&) = delete;
+    IngestionLogs& operator=(const IngestionLogs&) = delete;
+
+    // Opérations des producteurs, utilisables de plusieurs threads à la fois
+    bool ajouterLigneLog(const LigneLog& ligneLog);
+    void ajouterLigneLog(std::int64_t timestamp, const Utilisateur* utilisateur, const Film* film);
+
+    // Opérations de synchronisation
+    void vider();
+    template <typename Fonction>
+    auto consulter(Fonction fonction);
+
+    // Getters
+    std::uint64_t getNombreLignesRecues() const;
+    std::uint64_t getNombreLignesIngerees() const;
+
+private:
+    /// Log déposé par un producteur, en attente de fusion.
+    struct LogRecu
+    {
+        std::int64_t timestamp;
+        const Utilisateur* utilisateur;
+        const Film* film;
+    };
+
+    /// Tampon partagé par les producteurs dont le thread y est associé, seul sur sa ligne de cache.
+    struct alignas(64) Tampon
+    {
+        std::mutex mutex;
+        std::vector<LogRecu> logs;
+        std::uint64_t nombreLignesRecues = 0;
+    };
+
+    Tampon& getTamponThread();
+    void fusionner();
+    void executerFusions();
+
+    AnalyseurLogs* analyseurLogs_;
+    std::unique_ptr<Tampon[]> tampons_;
+    std::size_t nombreTampons_;
+    std::chrono::milliseconds intervalle_;
+
+    std::mutex mutexAnalyseur_; // Protège l'analyseur pendant une fusion ou une consultation
+    std::vector<LogRecu> logsEnFusion_; // Échangé avec chaque tampon à la fusion, protégé par mutexAnalyseur_
+    std::atomic<std::uint64_t> nombreLignesIngerees_ = 0;
+
+    std::mutex mutexArret_;
+    std::condition_variable conditionArret_;
+    bool estArrete_ = false;
+    std::thread threadFusion_; // Déclaré en dernier pour démarrer une fois les autres membres construits
+};
+
+/// Applique une fonction à l'analyseur entre deux fusions. Les logs encore dans les tampons n'y sont pas visibles;
+/// appeler vider() avant pour les inclure.
+/// \param fonction La fonction, appelée avec une référence constante à l'analyseur.
+/// \return         La valeur retournée par la fonction.
+template <typename Fonction>
+auto IngestionLogs::consulter(Fonction fonction)
+{
+    std::lock_guard verrou(mutexAnalyseur_);
+    return fonction(static_cast<const AnalyseurLogs&>(*analyseurLogs_));
+}
+
+#endif // INGESTIONLOGS_H
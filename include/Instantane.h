@@ -0,0 +1,29 @@
+/// Instantané binaire des gestionnaires et de l'analyseur de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef INSTANTANE_H
+#define INSTANTANE_H
+
+#include <cstdint>
+#include <string>
+#include "AnalyseurLogs.h"
+#include "GestionnaireFilms.h"
+#include "GestionnaireUtilisateurs.h"
+
+/// Classe qui sauvegarde et restaure ensemble l'état des gestionnaires d'utilisateurs et de films et de l'analyseur de
+/// logs dans un fichier binaire versionné. Les logs y référencent les films et les utilisateurs par leur position
+/// dans l'instantané plutôt que par pointeur, les identifiants denses des films et des utilisateurs sont conservés et
+/// une somme de contrôle permet de rejeter un fichier corrompu.
+class Instantane
+{
+public:
+    static constexpr std::uint32_t version = 3;
+
+    static bool sauvegarder(const std::string& nomFichier, const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                            const GestionnaireFilms& gestionnaireFilms, const AnalyseurLogs& analyseurLogs);
+    static bool charger(const std::string& nomFichier, GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                        GestionnaireFilms& gestionnaireFilms, AnalyseurLogs& analyseurLogs);
+};
+
+#endif // INSTANTANE_H
@@ -5,6 +5,8 @@
 #ifndef LIGNELOG_H
 #define LIGNELOG_H
 
+#include <cstdint>
+#include <iostream>
 #include <string>
 #include "Film.h"
 #include "Utilisateur.h"
@@ -17,4 +19,17 @@ struct LigneLog
     const Film* film;
 };
 
+/// Struct compacte conservée par l'analyseur de logs pour chaque ligne du log. L'horodatage est converti une seule
+/// fois à l'ingestion et l'utilisateur et le film sont des indices dans les tables de l'analyseur.
+struct EntreeLog
+{
+    std::int64_t timestamp; // Secondes depuis l'époque Unix
+    std::uint32_t utilisateur;
+    std::uint32_t film;
+};
+
+static_assert(sizeof(EntreeLog) == 16, "EntreeLog doit rester compacte");
+
+std::ostream& operator<<(std::ostream& outputStream, const LigneLog& ligneLog);
+
 #endif // LIGNELOG_H
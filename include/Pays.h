@@ -5,6 +5,7 @@
 #ifndef PAYS_H
 #define PAYS_H
 
+#include <cstddef>
 #include <string>
 
 /// Enum pour les différents pays.
@@ -21,6 +22,10 @@ enum class Pays
     Mexique
 };
 
+/// Nombre de pays, pour les tableaux indexés par pays.
+inline constexpr std::size_t nombrePays = static_cast<std::size_t>(Pays::Mexique) + 1;
+
+bool estPaysValide(Pays pays);
 std::string getPaysString(Pays pays);
 
 #endif // PAYS_H
@@ -0,0 +1,28 @@
+/// Requête de films sur plusieurs critères.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef REQUETEFILMS_H
+#define REQUETEFILMS_H
+
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Film.h"
+#include "Pays.h"
+
+/// Struct contenant les critères d'une recherche de films. Un film est retenu s'il satisfait tous les critères
+/// présents: son genre fait partie des genres, son pays fait partie des pays, son année est dans l'intervalle et son
+/// réalisateur est celui demandé. Un ensemble vide ou un critère absent ne restreint pas la recherche. Un genre ou
+/// un pays hors de son enum ne correspond à aucun film.
+struct RequeteFilms
+{
+    std::vector<Film::Genre> genres;
+    std::vector<Pays> pays;
+    int anneeDebut = std::numeric_limits<int>::min(); // Inclusive
+    int anneeFin = std::numeric_limits<int>::max(); // Inclusive
+    std::optional<std::string> realisateur;
+};
+
+#endif // REQUETEFILMS_H
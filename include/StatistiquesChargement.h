@@ -0,0 +1,24 @@
+/// Statistiques de débit d'un chargement de fichier.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef STATISTIQUESCHARGEMENT_H
+#define STATISTIQUESCHARGEMENT_H
+
+#include <cstddef>
+#include <iostream>
+
+/// Struct contenant la quantité de données traitée par un chargement ainsi que sa durée.
+struct StatistiquesChargement
+{
+    std::size_t nombreLignes = 0;
+    std::size_t nombreOctets = 0;
+    double dureeSecondes = 0.0;
+
+    double getLignesParSeconde() const;
+    double getOctetsParSeconde() const;
+};
+
+std::ostream& operator<<(std::ostream& outputStream, const StatistiquesChargement& statistiques);
+
+#endif // STATISTIQUESCHARGEMENT_H
@@ -0,0 +1,48 @@
+/// Suivi continu d'un fichier de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef SUIVILOGS_H
+#define SUIVILOGS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "AnalyseurLogs.h"
+#include "GestionnaireFilms.h"
+#include "GestionnaireUtilisateurs.h"
+
+/// Classe qui suit un fichier de logs auquel des lignes sont ajoutées (à la manière de tail -f) et qui n'ingère dans
+/// l'analyseur que les lignes complètes apparues depuis la dernière lecture. Le suivi est la seule source de
+/// l'analyseur: la première lecture, ainsi que toute lecture qui constate que le fichier a été tronqué, repart d'un
+/// analyseur vide.
+class SuiviLogs
+{
+public:
+    SuiviLogs(const std::string& nomFichier, AnalyseurLogs& analyseurLogs,
+              const GestionnaireUtilisateurs& gestionnaireUtilisateurs, const GestionnaireFilms& gestionnaireFilms,
+              std::chrono::milliseconds intervalle = std::chrono::seconds(1));
+
+    // Rafraîchissements
+    bool rafraichir();
+    bool rafraichirSiEcheance();
+    void suivre(const std::atomic<bool>& continuer);
+
+    // Getters
+    std::uintmax_t getPosition() const;
+
+private:
+    std::string nomFichier_;
+    AnalyseurLogs* analyseurLogs_;
+    const GestionnaireUtilisateurs* gestionnaireUtilisateurs_;
+    const GestionnaireFilms* gestionnaireFilms_;
+    std::chrono::milliseconds intervalle_;
+    std::chrono::steady_clock::time_point prochaineEcheance_;
+
+    std::uintmax_t position_ = 0; // Nombre d'octets du fichier déjà ingérés (toujours juste après un '\n')
+    bool estCommence_ = false;
+    std::string tampon_;
+};
+
+#endif // SUIVILOGS_H
@@ -0,0 +1,35 @@
+/// Popularité des films sur une fenêtre de temps glissante.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef TENDANCESFILMS_H
+#define TENDANCESFILMS_H
+
+#include <cstdint>
+#include "ClassementPopularite.h"
+#include "ColonnesLogs.h"
+
+/// Classe qui maintient le classement des films vus dans la fenêtre ]t - durée, t], où t est l'horodatage le plus
+/// récent du log. Les entrées de la fenêtre forment la fin des colonnes triées du log: il suffit de conserver la
+/// position de la plus ancienne et de l'avancer à mesure que t progresse, ce qui coûte O(1) amorti par vue.
+class TendancesFilms
+{
+public:
+    explicit TendancesFilms(std::int64_t dureeFenetre);
+
+    void initialiser(const ColonnesLogs& logs);
+    void comptabiliserEntreeLog(const EntreeLog& entreeLog);
+    void avancer(const ColonnesLogs& logs);
+    void effacer();
+
+    std::int64_t getDureeFenetre() const;
+    const ClassementPopularite& getClassement() const;
+
+private:
+    std::int64_t dureeFenetre_;
+    std::size_t debutFenetre_ = 0; // Position dans le log de la plus ancienne entrée de la fenêtre
+    std::int64_t limite_; // Les entrées dont l'horodatage est inférieur ou égal à la limite sont expirées
+    ClassementPopularite classement_;
+};
+
+#endif // TENDANCESFILMS_H
@@ -0,0 +1,21 @@
+/// Découpage sans copie des lignes des fichiers de données.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef TOKENISEUR_H
+#define TOKENISEUR_H
+
+#include <string>
+#include <string_view>
+
+/// Fonctions qui reproduisent l'extraction de std::istream (operator>> et std::quoted) directement sur des
+/// std::string_view. Chaque fonction consomme le début de la vue reçue et retourne false si l'extraction échoue.
+namespace Tokeniseur
+{
+    bool lireLigne(std::string_view& contenu, std::string_view& ligne);
+    bool lireMot(std::string_view& ligne, std::string_view& mot);
+    bool lireGuillemets(std::string_view& ligne, std::string_view& valeur, std::string& tampon);
+    bool lireEntier(std::string_view& ligne, int& valeur);
+} // namespace Tokeniseur
+
+#endif // TOKENISEUR_H
@@ -5,6 +5,7 @@
 #ifndef UTILISATEUR_H
 #define UTILISATEUR_H
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include "Pays.h"
@@ -16,6 +17,7 @@ struct Utilisateur
     std::string nom;
     int age;
     Pays pays;
+    std::uint32_t indice = 0; // Identifiant dense attribué par le gestionnaire, réutilisé après suppression
 };
 
 std::ostream& operator<<(std::ostream& outputStream, const Utilisateur& utilisateur);
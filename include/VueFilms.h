@@ -0,0 +1,76 @@
+/// Vue non propriétaire sur une liste de films.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#ifndef VUEFILMS_H
+#define VUEFILMS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Film.h"
+
+/// Vue en lecture seule sur une suite contiguë de pointeurs de films, sans copie ni allocation. La vue ne possède pas
+/// les pointeurs: elle reste valide tant que le conteneur d'origine n'est ni modifié ni détruit.
+class VueFilms
+{
+public:
+    using const_iterator = const Film* const*;
+
+    VueFilms() = default;
+
+    /// Constructeur à partir d'un vecteur de films, qui doit survivre à la vue.
+    /// \param films    Le vecteur sur lequel porte la vue.
+    VueFilms(const std::vector<const Film*>& films)
+        : debut_(films.data())
+        , taille_(films.size())
+    {
+    }
+
+    VueFilms(std::vector<const Film*>&&) = delete; // La vue ne doit pas survivre à un vecteur temporaire
+
+    /// Retourne un itérateur au premier film.
+    /// \return L'itérateur.
+    const_iterator begin() const { return debut_; }
+
+    /// Retourne un itérateur après le dernier film.
+    /// \return L'itérateur.
+    const_iterator end() const { return debut_ + taille_; }
+
+    /// Retourne le nombre de films de la vue.
+    /// \return Le nombre de films.
+    std::size_t size() const { return taille_; }
+
+    /// Indique si la vue ne contient aucun film.
+    /// \return True si la vue est vide.
+    bool empty() const { return taille_ == 0; }
+
+    /// Accède à un film de la vue.
+    /// \param index    La position du film (doit être inférieure à size()).
+    /// \return         Le film.
+    const Film* operator[](std::size_t index) const { return debut_[index]; }
+
+private:
+    const Film* const* debut_ = nullptr;
+    std::size_t taille_ = 0;
+};
+
+/// Compare le contenu de deux vues.
+/// \param vue1 Une des deux vues à comparer.
+/// \param vue2 Une des deux vues à comparer.
+/// \return     True si les deux vues contiennent les mêmes films dans le même ordre.
+inline bool operator==(VueFilms vue1, VueFilms vue2)
+{
+    return std::equal(vue1.begin(), vue1.end(), vue2.begin(), vue2.end());
+}
+
+/// Compare le contenu de deux vues.
+/// \param vue1 Une des deux vues à comparer.
+/// \param vue2 Une des deux vues à comparer.
+/// \return     True si les deux vues diffèrent.
+inline bool operator!=(VueFilms vue1, VueFilms vue2)
+{
+    return !(vue1 == vue2);
+}
+
+#endif // VUEFILMS_H
@@ -5,14 +5,140 @@
 
 #include "AnalyseurLogs.h"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <sstream>
-#include <unordered_set>
+#include "ChargementParallele.h"
+#include "FichierMappe.h"
 #include "Foncteurs.h"
+#include "Horodatage.h"
+#include "Tokeniseur.h"
 
-/// Ajoute les lignes de log en ordre chronologique à partir d'un fichier de logs.
+namespace
+{
+    /// Retrouve l'indice qu'un analyseur a attribué à un élément. L'indice est normalement l'identifiant dense de
+    /// l'élément; la table de débordement ne sert que pour les éléments dont l'identifiant était déjà pris par un
+    /// élément d'un autre gestionnaire.
+    /// \param element              L'utilisateur ou le film à chercher.
+    /// \param elementsParIndice    La table des éléments par indice.
+    /// \param debordement          La table des éléments dont l'indice diffère de leur identifiant.
+    /// \param indice               L'indice trouvé.
+    /// \return                     False si l'élément n'apparaît pas dans l'analyseur.
+    template<typename Element>
+    bool trouverIndice(const Element* element, const std::vector<const Element*>& elementsParIndice,
+                       const std::unordered_map<const Element*, std::uint32_t>& debordement, std::uint32_t& indice)
+    {
+        if (element == nullptr)
+        {
+            return false;
+        }
+        if (element->indice < elementsParIndice.size() && elementsParIndice[element->indice] == element)
+        {
+            indice = element->indice;
+            return true;
+        }
+        auto it = debordement.find(element);
+        if (it != debordement.end())
+        {
+            indice = it->second;
+            return true;
+        }
+        return false;
+    }
+
+    /// Retourne l'indice d'un élément dans l'analyseur en lui en attribuant un au besoin: son identifiant dense si
+    /// cette position est libre, sinon une nouvelle position à la fin de la table.
+    /// \param element              L'utilisateur ou le film.
+    /// \param elementsParIndice    La table des éléments par indice, agrandie au besoin.
+    /// \param debordement          La table des éléments dont l'indice diffère de leur identifiant.
+    /// \return                     L'indice de l'élément.
+    template<typename Element>
+    std::uint32_t attribuerIndice(const Element* element, std::vector<const Element*>& elementsParIndice,
+                                  std::unordered_map<const Element*, std::uint32_t>& debordement)
+    {
+        std::uint32_t indice;
+        if (trouverIndice(element, elementsParIndice, debordement, indice))
+        {
+            return indice;
+        }
+        if (element->indice >= elementsParIndice.size())
+        {
+            elementsParIndice.resize(element->indice + std::size_t{1}, nullptr);
+        }
+        if (elementsParIndice[element->indice] == nullptr)
+        {
+            elementsParIndice[element->indice] = element;
+            return element->indice;
+        }
+        indice = static_cast<std::uint32_t>(elementsParIndice.size());
+        elementsParIndice.push_back(element);
+        debordement.emplace(element, indice);
+        return indice;
+    }
+
+    /// Struct contenant une ligne de log interprétée et liée, avant son ajout à l'analyseur.
+    struct LogInterprete
+    {
+        std::int64_t timestamp;
+        const Utilisateur* utilisateur;
+        const Film* film;
+    };
+
+    /// Foncteur qui interprète une ligne de log sans copie et la lie à son utilisateur et à son film. Il conserve des
+    /// tampons réutilisés d'une ligne à l'autre, qui n'allouent plus une fois leur capacité atteinte.
+    class InterpreteurLigneLog
+    {
+    public:
+        /// Constructeur à partir des gestionnaires utilisés pour lier les logs.
+        /// \param gestionnaireUtilisateurs Le gestionnaire dans lequel chercher les utilisateurs.
+        /// \param gestionnaireFilms        Le gestionnaire dans lequel chercher les films.
+        InterpreteurLigneLog(const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                             const GestionnaireFilms& gestionnaireFilms)
+            : gestionnaireUtilisateurs_(&gestionnaireUtilisateurs)
+            , gestionnaireFilms_(&gestionnaireFilms)
+        {
+        }
+
+        /// Interprète une ligne et ajoute le log obtenu si l'utilisateur et le film existent.
+        /// \param ligne        La ligne à interpréter.
+        /// \param logs         Le vecteur auquel ajouter le log.
+        /// \return             False si la ligne n'a pas pu être interprétée.
+        bool operator()(std::string_view ligne, std::vector<LogInterprete>& logs)
+        {
+            std::string_view timestamp;
+            std::string_view idUtilisateur;
+            std::string_view nomFilm;
+            std::int64_t secondes;
+            if (!Tokeniseur::lireMot(ligne, timestamp) || !Tokeniseur::lireMot(ligne, idUtilisateur) ||
+                !Tokeniseur::lireGuillemets(ligne, nomFilm, tamponEchappement_) ||
+                !convertirHorodatage(timestamp, secondes))
+            {
+                return false;
+            }
+
+            const Utilisateur* utilisateur = gestionnaireUtilisateurs_->getUtilisateurParId(idUtilisateur);
+            const Film* film = gestionnaireFilms_->getFilmParNom(nomFilm);
+            if (film != nullptr && utilisateur != nullptr)
+            {
+                logs.push_back({secondes, utilisateur, film});
+            }
+            return true;
+        }
+
+    private:
+        const GestionnaireUtilisateurs* gestionnaireUtilisateurs_;
+        const GestionnaireFilms* gestionnaireFilms_;
+        std::string tamponEchappement_;
+    };
+} // namespace
+
+/// Ajoute les lignes de log en ordre chronologique à partir d'un fichier de logs. Une ligne dont l'horodatage n'est pas
+/// une date ISO 8601 valide est ignorée et rapportée comme une ligne mal formée.
 /// \param nomFichier               Le fichier à partir duquel lire les logs.
 /// \param gestionnaireUtilisateurs Référence au gestionnaire des utilisateurs pour lier un utilisateur à un log.
 /// \param gestionnaireFilms        Référence au gestionnaire des films pour pour lier un film à un log.
@@ -24,10 +150,10 @@ bool AnalyseurLogs::chargerDepuisFichier(const std::string& nomFichier,
     std::ifstream fichier(nomFichier);
     if (fichier)
     {
-        logs_.clear();
-        vuesFilms_.clear();
+        effacer();
 
         bool succesParsing = true;
+        std::vector<EntreeLog> entreesLog;
 
         std::string ligne;
         while (std::getline(fichier, ligne))
@@ -38,9 +164,16 @@ bool AnalyseurLogs::chargerDepuisFichier(const std::string& nomFichier,
             std::string idUtilisateur;
             std::string nomFilm;
 
-            if (stream >> timestamp >> idUtilisateur >> std::quoted(nomFilm))
+            std::int64_t secondes;
+            if (stream >> timestamp >> idUtilisateur >> std::quoted(nomFilm) &&
+                convertirHorodatage(timestamp, secondes))
             {
-                creerLigneLog(timestamp, idUtilisateur, nomFilm, gestionnaireUtilisateurs, gestionnaireFilms);
+                const Utilisateur* utilisateur = gestionnaireUtilisateurs.getUtilisateurParId(idUtilisateur);
+                const Film* film = gestionnaireFilms.getFilmParNom(nomFilm);
+                if (film != nullptr && utilisateur != nullptr)
+                {
+                    entreesLog.push_back(creerEntreeLog(secondes, utilisateur, film));
+                }
             }
             else
             {
@@ -49,12 +182,167 @@ bool AnalyseurLogs::chargerDepuisFichier(const std::string& nomFichier,
                 succesParsing = false;
             }
         }
+        ajouterEntreesLog(std::move(entreesLog));
+        return succesParsing;
+    }
+    std::cerr << "Erreur AnalyseurLogs: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
+    return false;
+}
+
+/// Ajoute les lignes de log en ordre chronologique en projetant le fichier en mémoire et en découpant chaque ligne
+/// sans copie. Le résultat et les erreurs rapportées sont identiques à ceux de chargerDepuisFichier.
+/// \param nomFichier               Le fichier à partir duquel lire les logs.
+/// \param gestionnaireUtilisateurs Référence au gestionnaire des utilisateurs pour lier un utilisateur à un log.
+/// \param gestionnaireFilms        Référence au gestionnaire des films pour pour lier un film à un log.
+/// \param statistiques             Si non nul, reçoit le nombre de lignes et d'octets traités ainsi que la durée.
+/// \return                         True si tout le chargement s'est effectué avec succès, false sinon.
+bool AnalyseurLogs::chargerDepuisFichierMappe(const std::string& nomFichier,
+                                              GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                              GestionnaireFilms& gestionnaireFilms,
+                                              StatistiquesChargement* statistiques)
+{
+    auto debut = std::chrono::steady_clock::now();
+
+    FichierMappe fichier(nomFichier);
+    if (fichier.estOuvert())
+    {
+        effacer();
+
+        bool succesParsing = true;
+        std::size_t nombreLignes = 0;
+        std::vector<LogInterprete> logs;
+        InterpreteurLigneLog interpreteur(gestionnaireUtilisateurs, gestionnaireFilms);
+
+        std::string_view contenu = fichier.getContenu();
+        std::string_view ligne;
+        while (Tokeniseur::lireLigne(contenu, ligne))
+        {
+            nombreLignes++;
+            if (!interpreteur(ligne, logs))
+            {
+                std::cerr << "Erreur AnalyseurLogs: la ligne " << ligne
+                          << " n'a pas pu être interprétée correctement\n";
+                succesParsing = false;
+            }
+        }
+
+        std::vector<EntreeLog> entreesLog;
+        entreesLog.reserve(logs.size());
+        for (const LogInterprete& log : logs)
+        {
+            entreesLog.push_back(creerEntreeLog(log.timestamp, log.utilisateur, log.film));
+        }
+        ajouterEntreesLog(std::move(entreesLog));
+
+        if (statistiques != nullptr)
+        {
+            statistiques->nombreLignes = nombreLignes;
+            statistiques->nombreOctets = fichier.getContenu().size();
+            statistiques->dureeSecondes =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        }
+        return succesParsing;
+    }
+    std::cerr << "Erreur AnalyseurLogs: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
+    return false;
+}
+
+/// Ajoute les lignes de log en ordre chronologique en interprétant le fichier projeté en mémoire par blocs sur
+/// plusieurs threads. Les blocs sont fusionnés dans l'ordre du fichier, donc le contenu final et les erreurs
+/// rapportées sont identiques à ceux de chargerDepuisFichier.
+/// \param nomFichier               Le fichier à partir duquel lire les logs.
+/// \param gestionnaireUtilisateurs Référence au gestionnaire des utilisateurs pour lier un utilisateur à un log.
+/// \param gestionnaireFilms        Référence au gestionnaire des films pour pour lier un film à un log.
+/// \param nombreThreads            Le nombre de threads à utiliser (0 pour le nombre de coeurs disponibles).
+/// \param statistiques             Si non nul, reçoit le nombre de lignes et d'octets traités ainsi que la durée.
+/// \return                         True si tout le chargement s'est effectué avec succès, false sinon.
+bool AnalyseurLogs::chargerDepuisFichierParallele(const std::string& nomFichier,
+                                                  GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                                  GestionnaireFilms& gestionnaireFilms, std::size_t nombreThreads,
+                                                  StatistiquesChargement* statistiques)
+{
+    auto debut = std::chrono::steady_clock::now();
+
+    FichierMappe fichier(nomFichier);
+    if (fichier.estOuvert())
+    {
+        effacer();
+
+        auto resultats = ChargementParallele::interpreterLignes<LogInterprete>(
+            fichier.getContenu(), nombreThreads, InterpreteurLigneLog(gestionnaireUtilisateurs, gestionnaireFilms));
+
+        bool succesParsing = true;
+        std::size_t nombreLignes = 0;
+        std::size_t nombreEntrees = 0;
+        for (const auto& resultat : resultats)
+        {
+            nombreEntrees += resultat.elements.size();
+        }
+        std::vector<EntreeLog> entreesLog;
+        entreesLog.reserve(nombreEntrees);
+        for (const auto& resultat : resultats)
+        {
+            nombreLignes += resultat.nombreLignes;
+            for (const LogInterprete& log : resultat.elements)
+            {
+                entreesLog.push_back(creerEntreeLog(log.timestamp, log.utilisateur, log.film));
+            }
+            for (std::string_view ligne : resultat.lignesInvalides)
+            {
+                std::cerr << "Erreur AnalyseurLogs: la ligne " << ligne
+                          << " n'a pas pu être interprétée correctement\n";
+                succesParsing = false;
+            }
+        }
+        ajouterEntreesLog(std::move(entreesLog));
+
+        if (statistiques != nullptr)
+        {
+            statistiques->nombreLignes = nombreLignes;
+            statistiques->nombreOctets = fichier.getContenu().size();
+            statistiques->dureeSecondes =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+        }
         return succesParsing;
     }
     std::cerr << "Erreur AnalyseurLogs: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
     return false;
 }
 
+/// Ajoute en ordre chronologique les logs contenus dans un texte, sans effacer les logs existants. Sert à ingérer
+/// les lignes ajoutées à un fichier depuis sa dernière lecture.
+/// \param texte                    Les lignes à interpréter, au même format que le fichier de logs.
+/// \param gestionnaireUtilisateurs Référence au gestionnaire des utilisateurs pour lier un utilisateur à un log.
+/// \param gestionnaireFilms        Référence au gestionnaire des films pour pour lier un film à un log.
+/// \return                         True si toutes les lignes ont été interprétées avec succès, false sinon.
+bool AnalyseurLogs::ajouterLignesDepuisTexte(std::string_view texte,
+                                             const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                                             const GestionnaireFilms& gestionnaireFilms)
+{
+    bool succesParsing = true;
+    std::vector<LogInterprete> logs;
+    InterpreteurLigneLog interpreteur(gestionnaireUtilisateurs, gestionnaireFilms);
+
+    std::string_view ligne;
+    while (Tokeniseur::lireLigne(texte, ligne))
+    {
+        if (!interpreteur(ligne, logs))
+        {
+            std::cerr << "Erreur AnalyseurLogs: la ligne " << ligne << " n'a pas pu être interprétée correctement\n";
+            succesParsing = false;
+        }
+    }
+
+    std::vector<EntreeLog> entreesLog;
+    entreesLog.reserve(logs.size());
+    for (const LogInterprete& log : logs)
+    {
+        entreesLog.push_back(creerEntreeLog(log.timestamp, log.utilisateur, log.film));
+    }
+    ajouterEntreesLog(std::move(entreesLog));
+    return succesParsing;
+}
+
 /// Création d'une ligne log nécessitant un timestamp, un utilisateur et un film.
 /// \param timestamp                Représentant le moment où l'utilisateur a écouté le film.
 /// \param idUtilisateur            Clé permettant l'accès à l'utilisateur dans le gestionnaireUtilisateur.
@@ -69,19 +357,78 @@ bool AnalyseurLogs::creerLigneLog(const std::string& timestamp, const std::strin
     const Film* film = gestionnaireFilms.getFilmParNom(nomFilm);
     if (film != nullptr && utilisateur != nullptr)
     {
-        ajouterLigneLog({timestamp, utilisateur, film});
-        return true;
+        return ajouterLigneLog({timestamp, utilisateur, film});
     }
     return false;
 }
 
-/// Methode qui ajoute une Ligne de log dans l'analyseur de logs d'une facon ordonnée.
+/// Methode qui ajoute une Ligne de log dans l'analyseur de logs d'une facon ordonnée. Les logs sont conservés avec leur
+/// horodatage converti en secondes, donc une ligne dont l'horodatage ne peut pas être converti n'est pas ajoutée.
 /// \param ligneLog    La ligneLog que nous voulons ajouter.
-void AnalyseurLogs::ajouterLigneLog(const LigneLog& ligneLog)
+/// \return            False si le timestamp n'est pas un horodatage valide, auquel cas la ligne est ignorée.
+bool AnalyseurLogs::ajouterLigneLog(const LigneLog& ligneLog)
+{
+    std::int64_t secondes;
+    if (!convertirHorodatage(ligneLog.timestamp, secondes))
+    {
+        return false;
+    }
+    EntreeLog entreeLog = creerEntreeLog(secondes, ligneLog.utilisateur, ligneLog.film);
+    if (compteurApproximatif_)
+    {
+        comptabiliserEntreeLogApproximative(entreeLog);
+        return true;
+    }
+    logs_.inserer(entreeLog);
+    comptabiliserEntreeLog(entreeLog);
+    if (tendances_)
+    {
+        tendances_->avancer(logs_);
+    }
+    return true;
+}
+
+/// Ajoute un lot de lignes de log en une seule passe: le lot est trié de façon stable puis fusionné avec les logs
+/// existants. L'ordre obtenu est le même que si chaque ligne avait été ajoutée avec ajouterLigneLog, à coût
+/// O(n log n) plutôt que O(n²).
+/// \param lignesLog    Les lignes de log à ajouter, dans leur ordre d'arrivée.
+/// \return             False si au moins une ligne avait un horodatage invalide et a été ignorée.
+bool AnalyseurLogs::ajouterLignesLog(const std::vector<LigneLog>& lignesLog)
 {
-    auto it = std::upper_bound(logs_.begin(), logs_.end(), ligneLog, ComparateurLog()); 
-    logs_.insert(it, ligneLog);
-    vuesFilms_[ligneLog.film]++;
+    bool succes = true;
+    std::vector<EntreeLog> entreesLog;
+    entreesLog.reserve(lignesLog.size());
+    for (const LigneLog& ligneLog : lignesLog)
+    {
+        std::int64_t secondes;
+        if (convertirHorodatage(ligneLog.timestamp, secondes))
+        {
+            entreesLog.push_back(creerEntreeLog(secondes, ligneLog.utilisateur, ligneLog.film));
+        }
+        else
+        {
+            succes = false;
+        }
+    }
+    ajouterEntreesLog(std::move(entreesLog));
+    return succes;
+}
+
+/// Retourne le nombre de lignes de log conservées.
+/// \return    Le nombre de lignes de log.
+std::size_t AnalyseurLogs::getNombreLignesLog() const
+{
+    return logs_.getNombreEntrees();
+}
+
+/// Reconstruit une ligne de log à partir de sa forme compacte, avec son horodatage sous forme de texte.
+/// \param index    La position de la ligne dans l'ordre chronologique (doit être inférieure à getNombreLignesLog()).
+/// \return         La ligne de log.
+LigneLog AnalyseurLogs::getLigneLog(std::size_t index) const
+{
+    EntreeLog entreeLog = logs_.getEntree(index);
+    return LigneLog{formaterHorodatage(entreeLog.timestamp), utilisateurs_[entreeLog.utilisateur],
+                    films_[entreeLog.film]};
 }
 
 /// Trouve et retourne le nombre de vues pour le film passe en parametre.
@@ -89,10 +436,11 @@ void AnalyseurLogs::ajouterLigneLog(const LigneLog& ligneLog)
 /// \return        Le nombre de vues du film.
 int AnalyseurLogs::getNombreVuesFilm(const Film* film) const
 {
-    auto it = vuesFilms_.find(film);
-    if (it != vuesFilms_.end())
+    std::uint32_t indice;
+    if (trouverIndice(film, films_, debordementFilms_, indice))
     {
-        return it->second;
+        return compteurApproximatif_ ? compteurApproximatif_->estimerVues(indice)
+                                     : classementFilms_.getNombreVues(indice);
     }
     return 0;
 }
@@ -101,9 +449,14 @@ int AnalyseurLogs::getNombreVuesFilm(const Film* film) const
 /// \return    Un pointeur constant vers le film le plus populaire ou un nullptr si aucun film n'est dans l'analyseur de logs.
 const Film* AnalyseurLogs::getFilmPlusPopulaire() const
 {
-    if (logs_.size() != 0)
+    if (compteurApproximatif_)
     {
-        return std::max_element(vuesFilms_.begin(), vuesFilms_.end(), ComparateurSecondElementPaire<const Film*, int>())->first;
+        std::vector<std::pair<const Film*, int>> filmPlusPop = getNFilmsPlusPopulaires(1);
+        return filmPlusPop.empty() ? nullptr : filmPlusPop.front().first;
+    }
+    if (!classementFilms_.getOrdre().empty())
+    {
+        return films_[classementFilms_.getOrdre().front()];
     }
     return nullptr;
 }
@@ -113,36 +466,534 @@ const Film* AnalyseurLogs::getFilmPlusPopulaire() const
 /// \return         Liste vers les films les plus populaires ainsi que le nombre de vues pour chacun d'entres eux. 
 std::vector<std::pair<const Film*, int>> AnalyseurLogs::getNFilmsPlusPopulaires(std::size_t nombre) const
 {
-    std::vector<std::pair<const Film*, int>> filmsPlusPop (std::min(logs_.size(), nombre));
-    std::partial_sort_copy(vuesFilms_.begin(), vuesFilms_.end(), filmsPlusPop.begin(), filmsPlusPop.end(),
-                           [](const std::pair<const Film*, int>& pair1, const std::pair<const Film*, int>& pair2)
-                           { return pair1.second > pair2.second; });
-    filmsPlusPop.erase(std::remove_if(filmsPlusPop.begin(), filmsPlusPop.end(), [](auto pair){ return pair.second == 0; }), filmsPlusPop.end());
-    return filmsPlusPop;
+    if (compteurApproximatif_)
+    {
+        std::vector<std::pair<const Film*, int>> filmsPlusPop;
+        for (const std::pair<std::uint32_t, int>& filmPlusVu : compteurApproximatif_->getPlusVus(nombre))
+        {
+            filmsPlusPop.emplace_back(films_[filmPlusVu.first], filmPlusVu.second);
+        }
+        return filmsPlusPop;
+    }
+    return getNFilmsPlusPopulaires(classementFilms_, nombre);
+}
+
+/// Calcule le nombre de vues d'un réalisateur en additionnant le nombre de vues de chacun de ses films, en O(k) pour
+/// un réalisateur ayant k films, sans parcourir les logs. En mode approximatif, la somme porte sur les estimations.
+/// \param realisateur          Le nom du réalisateur.
+/// \param gestionnaireFilms    Le gestionnaire dans lequel chercher les films du réalisateur.
+/// \return                     Le nombre de vues de tous les films du réalisateur.
+int AnalyseurLogs::getNombreVuesRealisateur(std::string_view realisateur,
+                                            const GestionnaireFilms& gestionnaireFilms) const
+{
+    VueFilms filmsRealisateur = gestionnaireFilms.getFilmsParRealisateur(realisateur);
+    return std::accumulate(filmsRealisateur.begin(), filmsRealisateur.end(), 0,
+                           [this](int total, const Film* film) { return total + getNombreVuesFilm(film); });
 }
 
-/// Trouve et retourne le nombre de films vus par un utilisateur.
+/// Trouve les réalisateurs dont les films ont le plus de vues au total, en additionnant le nombre de vues déjà tenu
+/// pour chaque film plutôt qu'en parcourant les logs, en O(f + r log nombre) pour f films et r réalisateurs vus.
+/// \param nombre   Le nombre maximal de réalisateurs à retourner.
+/// \return         Les réalisateurs ayant au moins une vue, en ordre décroissant de vues, avec leur nombre de vues.
+std::vector<std::pair<ChaineInternee, int>> AnalyseurLogs::getNRealisateursPlusPopulaires(std::size_t nombre) const
+{
+    // Les réalisateurs vus sont comptés selon leur identifiant interné plutôt que dans un tableau couvrant toutes les
+    // chaînes internées, dont le nombre ne fait que croître
+    std::unordered_map<std::uint32_t, std::size_t> positionsRealisateurs;
+    std::vector<std::pair<ChaineInternee, int>> realisateursPlusPop;
+    for (std::uint32_t indice = 0; indice < films_.size(); indice++)
+    {
+        const Film* film = films_[indice];
+        if (film == nullptr)
+        {
+            continue;
+        }
+        int vues = compteurApproximatif_ ? compteurApproximatif_->estimerVues(indice)
+                                         : classementFilms_.getNombreVues(indice);
+        if (vues <= 0)
+        {
+            continue;
+        }
+        auto [it, estNouveau] =
+            positionsRealisateurs.try_emplace(film->realisateur.getIdentifiant(), realisateursPlusPop.size());
+        if (estNouveau)
+        {
+            realisateursPlusPop.emplace_back(film->realisateur, 0);
+        }
+        realisateursPlusPop[it->second].second += vues;
+    }
+
+    auto fin = std::next(realisateursPlusPop.begin(),
+                         static_cast<std::ptrdiff_t>(std::min(realisateursPlusPop.size(), nombre)));
+    std::partial_sort(realisateursPlusPop.begin(), fin, realisateursPlusPop.end(),
+                      [](const auto& realisateur1, const auto& realisateur2)
+                      { return realisateur1.second > realisateur2.second; });
+    realisateursPlusPop.erase(fin, realisateursPlusPop.end());
+    return realisateursPlusPop;
+}
+
+/// Trouve et retourne le nombre de films vus par un utilisateur, en O(1) grâce au décompte tenu par utilisateur.
 /// \param utilisateur    L'utilisateur pour lequel nous voulons vérifier son nombre de vues.
 /// \return               Le nombre de films qu'un utilisateur donne à vus.
 int AnalyseurLogs::getNombreVuesPourUtilisateur(const Utilisateur* utilisateur) const
 {
-    auto lambda = [utilisateur](LigneLog ligneLog){ return utilisateur == ligneLog.utilisateur; };
-    return static_cast<int>(std::count_if(logs_.begin(), logs_.end(), lambda));
+    std::uint32_t indice;
+    if (trouverIndice(utilisateur, utilisateurs_, debordementUtilisateurs_, indice))
+    {
+        return vuesUtilisateurs_[indice];
+    }
+    return 0;
 }
 
-/// Permet de listé tout les films qu'un utilisateur précis à visionné.
+/// Permet de listé tout les films qu'un utilisateur précis à visionné, en O(k) pour k films distincts grâce à la
+/// liste des films vus tenue par utilisateur.
 /// \param utilisateur    L'utilisateur dont l'on souhaite obtenir tout les films visionnés.
-/// \return               Un vecteur de pointeurs constant vers les films visionnés par l'utilisateur.
+/// \return               Un vecteur de pointeurs constant vers les films visionnés par l'utilisateur, en ordre
+///                       croissant d'identifiant de film.
 std::vector<const Film*> AnalyseurLogs::getFilmsVusParUtilisateur(const Utilisateur* utilisateur) const
 {
-    std::unordered_set<const Film*> filmsVus;
+    std::uint32_t indice;
+    if (!trouverIndice(utilisateur, utilisateurs_, debordementUtilisateurs_, indice))
+    {
+        return std::vector<const Film*>();
+    }
+
+    const std::vector<std::uint32_t>& filmsVus = filmsVusUtilisateurs_[indice];
+    std::vector<const Film*> films;
+    films.reserve(filmsVus.size());
+    std::transform(filmsVus.begin(), filmsVus.end(), std::back_inserter(films),
+                   [this](std::uint32_t indiceFilm) { return films_[indiceFilm]; });
+    return films;
+}
+
+/// Trouve et retourne le nombre de vues d'un film pendant un intervalle de temps. Seules les entrées de l'intervalle,
+/// trouvées par recherche binaire, sont parcourues.
+/// \param film     Le film pour lequel nous voulons vérifier son nombre de vues.
+/// \param debut    Le début de l'intervalle (inclus), en secondes depuis l'époque Unix.
+/// \param fin      La fin de l'intervalle (exclue), en secondes depuis l'époque Unix.
+/// \return         Le nombre de vues du film dans l'intervalle.
+int AnalyseurLogs::getNombreVuesFilm(const Film* film, std::int64_t debut, std::int64_t fin) const
+{
+    std::uint32_t indice;
+    if (!trouverIndice(film, films_, debordementFilms_, indice))
+    {
+        return 0;
+    }
+    TrancheLogs tranche = logs_.getTranche(debut, fin);
+    const std::uint32_t* films = tranche.getFilms();
+    return static_cast<int>(std::count(films, films + tranche.getNombreEntrees(), indice));
+}
+
+/// Trouve et retourne les films les plus populaires pendant un intervalle de temps, en O(k log k) pour k logs dans
+/// l'intervalle: les indices de films de la tranche sont triés puis comptés par séquences, sans parcourir le catalogue.
+/// \param nombre   Le nombre maximal de films à retourner.
+/// \param debut    Le début de l'intervalle (inclus), en secondes depuis l'époque Unix.
+/// \param fin      La fin de l'intervalle (exclue), en secondes depuis l'époque Unix.
+/// \return         Les films les plus populaires de l'intervalle ainsi que leur nombre de vues dans l'intervalle.
+std::vector<std::pair<const Film*, int>> AnalyseurLogs::getNFilmsPlusPopulaires(std::size_t nombre,
+                                                                                 std::int64_t debut,
+                                                                                 std::int64_t fin) const
+{
+    TrancheLogs tranche = logs_.getTranche(debut, fin);
+    std::vector<std::uint32_t> indicesFilms(tranche.getFilms(), tranche.getFilms() + tranche.getNombreEntrees());
+    std::sort(indicesFilms.begin(), indicesFilms.end());
+    std::vector<std::pair<std::uint32_t, int>> vuesFilms;
+    for (auto it = indicesFilms.begin(); it != indicesFilms.end();)
+    {
+        auto finSequence = std::upper_bound(it, indicesFilms.end(), *it);
+        vuesFilms.emplace_back(*it, static_cast<int>(std::distance(it, finSequence)));
+        it = finSequence;
+    }
+
+    auto finRetenus = std::next(vuesFilms.begin(), static_cast<std::ptrdiff_t>(std::min(vuesFilms.size(), nombre)));
+    std::partial_sort(vuesFilms.begin(), finRetenus, vuesFilms.end(),
+                      [](const auto& vuesFilm1, const auto& vuesFilm2) { return vuesFilm1.second > vuesFilm2.second; });
+
+    std::vector<std::pair<const Film*, int>> filmsPlusPop;
+    filmsPlusPop.reserve(static_cast<std::size_t>(std::distance(vuesFilms.begin(), finRetenus)));
+    std::transform(vuesFilms.begin(), finRetenus, std::back_inserter(filmsPlusPop),
+                   [this](const auto& vuesFilm) { return std::make_pair(films_[vuesFilm.first], vuesFilm.second); });
+    return filmsPlusPop;
+}
+
+/// Trouve et retourne le nombre de films vus par un utilisateur pendant un intervalle de temps.
+/// \param utilisateur  L'utilisateur pour lequel nous voulons vérifier son nombre de vues.
+/// \param debut        Le début de l'intervalle (inclus), en secondes depuis l'époque Unix.
+/// \param fin          La fin de l'intervalle (exclue), en secondes depuis l'époque Unix.
+/// \return             Le nombre de vues de l'utilisateur dans l'intervalle.
+int AnalyseurLogs::getNombreVuesPourUtilisateur(const Utilisateur* utilisateur, std::int64_t debut,
+                                                std::int64_t fin) const
+{
+    return getNombreVuesPourUtilisateur(utilisateur, logs_.getTranche(debut, fin));
+}
+
+/// Liste les films qu'un utilisateur a visionnés pendant un intervalle de temps.
+/// \param utilisateur  L'utilisateur dont l'on souhaite obtenir les films visionnés.
+/// \param debut        Le début de l'intervalle (inclus), en secondes depuis l'époque Unix.
+/// \param fin          La fin de l'intervalle (exclue), en secondes depuis l'époque Unix.
+/// \return             Les films visionnés par l'utilisateur dans l'intervalle, sans doublons.
+std::vector<const Film*> AnalyseurLogs::getFilmsVusParUtilisateur(const Utilisateur* utilisateur,
+                                                                  std::int64_t debut, std::int64_t fin) const
+{
+    return getFilmsVusParUtilisateur(utilisateur, logs_.getTranche(debut, fin));
+}
+
+/// Active le mode approximatif: les logs ajoutés ensuite ne sont plus conservés et seules leurs vues par film sont
+/// comptées par une esquisse Count-Min et un résumé Space-Saving, en mémoire fixe. Après N vues,
+/// getNombreVuesFilm retourne une estimation v̂ d'un film ayant v vues telle que v ≤ v̂ ≤ v + εN avec une
+/// probabilité d'au moins 1 - δ, et getNFilmsPlusPopulaires retourne des films suivis, qui incluent tous les films
+/// ayant plus de N/k vues, avec une estimation de même garantie qui surestime aussi d'au plus N/k.
+/// \param erreurRelative       L'erreur ε, entre 0 et 1 exclusivement (par exemple 0.001).
+/// \param probabiliteEchec     La probabilité δ, entre 0 et 1 exclusivement (par exemple 0.01).
+/// \param nombreFilmsSuivis    Le nombre k de films suivis pour le classement, strictement positif.
+/// \return                     False si les paramètres sont invalides ou si l'analyseur n'est pas vide ou a les
+///                             tendances activées.
+bool AnalyseurLogs::activerModeApproximatif(double erreurRelative, double probabiliteEchec,
+                                            std::size_t nombreFilmsSuivis)
+{
+    if (!(erreurRelative > 0.0 && erreurRelative < 1.0) || !(probabiliteEchec > 0.0 && probabiliteEchec < 1.0) ||
+        nombreFilmsSuivis == 0)
+    {
+        std::cerr << "Erreur AnalyseurLogs: les paramètres du mode approximatif sont invalides\n";
+        return false;
+    }
+    if (!logs_.estVide() || tendances_)
+    {
+        std::cerr << "Erreur AnalyseurLogs: le mode approximatif doit être activé sur un analyseur vide sans "
+                     "tendances\n";
+        return false;
+    }
+    compteurApproximatif_.emplace(erreurRelative, probabiliteEchec, nombreFilmsSuivis);
+    return true;
+}
+
+/// Indique si l'analyseur est en mode approximatif.
+/// \return True si les logs ne sont pas conservés et les vues par film sont estimées.
+bool AnalyseurLogs::estApproximatif() const
+{
+    return compteurApproximatif_.has_value();
+}
+
+/// Active l'estimation du nombre de spectateurs distincts par film et par pays et du nombre de films distincts par
+/// utilisateur, par une esquisse HyperLogLog de 2^precision octets par film, par utilisateur et par pays. Les
+/// esquisses sont construites à partir des logs existants puis maintenues à chaque ajout, aussi en mode approximatif.
+/// \param precision    La précision des esquisses, entre 4 et 16 (par exemple 10 pour une erreur type de 3,25 %).
+/// \return             False si la précision est hors bornes ou si des vues ont déjà été comptées en mode
+///                     approximatif, sans être conservées.
+bool AnalyseurLogs::activerCardinalites(std::uint8_t precision)
+{
+    if (precision < HyperLogLog::precisionMinimale || precision > HyperLogLog::precisionMaximale)
+    {
+        std::cerr << "Erreur AnalyseurLogs: la précision des cardinalités doit être entre 4 et 16\n";
+        return false;
+    }
+    if (compteurApproximatif_ && compteurApproximatif_->getEsquisse().getNombreAjouts() > 0)
+    {
+        std::cerr << "Erreur AnalyseurLogs: les cardinalités doivent être activées avant d'ajouter des logs en mode "
+                     "approximatif\n";
+        return false;
+    }
+    cardinalites_.emplace(precision);
+    for (std::size_t i = 0; i < logs_.getNombreEntrees(); i++)
+    {
+        EntreeLog entreeLog = logs_.getEntree(i);
+        cardinalites_->comptabiliserEntreeLog(entreeLog, utilisateurs_[entreeLog.utilisateur], films_[entreeLog.film]);
+    }
+    return true;
+}
+
+/// Désactive les cardinalités et libère leurs esquisses.
+void AnalyseurLogs::desactiverCardinalites()
+{
+    cardinalites_.reset();
+}
+
+/// Estime le nombre d'utilisateurs distincts ayant vu un film.
+/// \param film    Le film.
+/// \return        L'estimation, 0 si le film n'a aucune vue ou si les cardinalités ne sont pas activées.
+std::int64_t AnalyseurLogs::getNombreSpectateursDistincts(const Film* film) const
+{
+    const HyperLogLog* esquisse = getEsquisseSpectateurs(film);
+    return esquisse ? std::llround(esquisse->estimer()) : 0;
+}
+
+/// Estime le nombre de films distincts vus par un utilisateur.
+/// \param utilisateur L'utilisateur.
+/// \return            L'estimation, 0 si l'utilisateur n'a aucune vue ou si les cardinalités ne sont pas activées.
+std::int64_t AnalyseurLogs::getNombreFilmsDistincts(const Utilisateur* utilisateur) const
+{
+    const HyperLogLog* esquisse = getEsquisseFilms(utilisateur);
+    return esquisse ? std::llround(esquisse->estimer()) : 0;
+}
+
+/// Estime le nombre d'utilisateurs distincts d'un pays ayant vu au moins un film.
+/// \param pays    Le pays des utilisateurs.
+/// \return        L'estimation, 0 si le pays est invalide ou si les cardinalités ne sont pas activées.
+std::int64_t AnalyseurLogs::getNombreSpectateursDistincts(Pays pays) const
+{
+    const HyperLogLog* esquisse = getEsquisseSpectateurs(pays);
+    return esquisse ? std::llround(esquisse->estimer()) : 0;
+}
+
+/// Retourne l'esquisse des utilisateurs distincts d'un film, qui peut être fusionnée avec celle d'un autre analyseur
+/// couvrant une autre partition des logs des mêmes gestionnaires.
+/// \param film    Le film.
+/// \return        L'esquisse, ou nullptr si le film n'a aucune vue ou si les cardinalités ne sont pas activées.
+const HyperLogLog* AnalyseurLogs::getEsquisseSpectateurs(const Film* film) const
+{
+    std::uint32_t indice;
+    if (cardinalites_ && trouverIndice(film, films_, debordementFilms_, indice))
+    {
+        return cardinalites_->getSpectateursFilm(indice);
+    }
+    return nullptr;
+}
 
-    for (const auto& log : logs_)
+/// Retourne l'esquisse des films distincts vus par un utilisateur, qui peut être fusionnée avec celle d'un autre
+/// analyseur couvrant une autre partition des logs des mêmes gestionnaires.
+/// \param utilisateur L'utilisateur.
+/// \return            L'esquisse, ou nullptr si l'utilisateur n'a aucune vue ou si les cardinalités ne sont pas
+///                    activées.
+const HyperLogLog* AnalyseurLogs::getEsquisseFilms(const Utilisateur* utilisateur) const
+{
+    std::uint32_t indice;
+    if (cardinalites_ && trouverIndice(utilisateur, utilisateurs_, debordementUtilisateurs_, indice))
     {
-        if (log.utilisateur == utilisateur)
+        return cardinalites_->getFilmsUtilisateur(indice);
+    }
+    return nullptr;
+}
+
+/// Retourne l'esquisse des utilisateurs distincts d'un pays, qui peut être fusionnée avec celle d'un autre analyseur
+/// couvrant une autre partition des logs des mêmes gestionnaires.
+/// \param pays    Le pays des utilisateurs.
+/// \return        L'esquisse, ou nullptr si le pays est invalide ou si les cardinalités ne sont pas activées.
+const HyperLogLog* AnalyseurLogs::getEsquisseSpectateurs(Pays pays) const
+{
+    return cardinalites_ ? cardinalites_->getSpectateursPays(pays) : nullptr;
+}
+
+/// Active les tendances: le classement des films vus pendant la durée donnée, jusqu'au log le plus récent, est
+/// construit à partir des logs existants puis maintenu à chaque ajout.
+/// \param dureeFenetre La durée de la fenêtre en secondes (par exemple 3600 pour la dernière heure).
+/// \return             False si la durée n'est pas strictement positive ou si l'analyseur est en mode approximatif.
+bool AnalyseurLogs::activerTendances(std::int64_t dureeFenetre)
+{
+    if (dureeFenetre <= 0)
+    {
+        std::cerr << "Erreur AnalyseurLogs: la durée de la fenêtre des tendances doit être positive\n";
+        return false;
+    }
+    if (compteurApproximatif_)
+    {
+        std::cerr << "Erreur AnalyseurLogs: les tendances ne sont pas disponibles en mode approximatif\n";
+        return false;
+    }
+    tendances_.emplace(dureeFenetre);
+    tendances_->initialiser(logs_);
+    return true;
+}
+
+/// Désactive les tendances et libère leur classement.
+void AnalyseurLogs::desactiverTendances()
+{
+    tendances_.reset();
+}
+
+/// Trouve et retourne le film le plus vu dans la fenêtre des tendances.
+/// \return    Le film le plus vu dans la fenêtre, ou nullptr si aucun film n'y a été vu ou si les tendances ne sont
+///            pas activées.
+const Film* AnalyseurLogs::getFilmTendance() const
+{
+    if (tendances_ && !tendances_->getClassement().getOrdre().empty())
+    {
+        return films_[tendances_->getClassement().getOrdre().front()];
+    }
+    return nullptr;
+}
+
+/// Trouve et retourne les films les plus vus dans la fenêtre des tendances, en O(nombre).
+/// \param nombre   Le nombre maximal de films à retourner.
+/// \return         Les films les plus vus dans la fenêtre avec leur nombre de vues dans la fenêtre (vide si les
+///                 tendances ne sont pas activées).
+std::vector<std::pair<const Film*, int>> AnalyseurLogs::getNFilmsTendance(std::size_t nombre) const
+{
+    if (!tendances_)
+    {
+        return std::vector<std::pair<const Film*, int>>();
+    }
+    return getNFilmsPlusPopulaires(tendances_->getClassement(), nombre);
+}
+
+/// Copie les premiers films d'un classement, en O(nombre).
+/// \param classement   Le classement par indice de film.
+/// \param nombre       Le nombre maximal de films à retourner.
+/// \return             Les films en ordre décroissant de vues, avec leur nombre de vues.
+std::vector<std::pair<const Film*, int>> AnalyseurLogs::getNFilmsPlusPopulaires(const ClassementPopularite& classement,
+                                                                                 std::size_t nombre) const
+{
+    const std::vector<std::uint32_t>& ordre = classement.getOrdre();
+    auto fin = std::next(ordre.begin(), static_cast<std::ptrdiff_t>(std::min(ordre.size(), nombre)));
+    std::vector<std::pair<const Film*, int>> filmsPlusPop;
+    filmsPlusPop.reserve(static_cast<std::size_t>(std::distance(ordre.begin(), fin)));
+    std::transform(ordre.begin(), fin, std::back_inserter(filmsPlusPop),
+                   [this, &classement](std::uint32_t indice)
+                   { return std::make_pair(films_[indice], classement.getNombreVues(indice)); });
+    return filmsPlusPop;
+}
+
+/// Compte les vues d'un utilisateur dans une tranche du log. Seule la colonne des utilisateurs est parcourue.
+/// \param utilisateur  L'utilisateur dont on compte les vues.
+/// \param tranche      La tranche du log à parcourir.
+/// \return             Le nombre de vues de l'utilisateur dans la tranche.
+int AnalyseurLogs::getNombreVuesPourUtilisateur(const Utilisateur* utilisateur, const TrancheLogs& tranche) const
+{
+    std::uint32_t indice;
+    if (!trouverIndice(utilisateur, utilisateurs_, debordementUtilisateurs_, indice))
+    {
+        return 0;
+    }
+    const std::uint32_t* utilisateurs = tranche.getUtilisateurs();
+    return static_cast<int>(std::count(utilisateurs, utilisateurs + tranche.getNombreEntrees(), indice));
+}
+
+/// Liste les films distincts vus par un utilisateur dans une tranche du log. Seules les colonnes des utilisateurs et
+/// des films sont parcourues, et seuls les films de l'utilisateur sont dédoublonnés, sans table couvrant le catalogue.
+/// \param utilisateur  L'utilisateur dont on liste les films.
+/// \param tranche      La tranche du log à parcourir.
+/// \return             Les films vus, en ordre croissant d'identifiant de film.
+std::vector<const Film*> AnalyseurLogs::getFilmsVusParUtilisateur(const Utilisateur* utilisateur,
+                                                                  const TrancheLogs& tranche) const
+{
+    std::uint32_t indice;
+    if (!trouverIndice(utilisateur, utilisateurs_, debordementUtilisateurs_, indice))
+    {
+        return std::vector<const Film*>();
+    }
+
+    const std::uint32_t* utilisateurs = tranche.getUtilisateurs();
+    const std::uint32_t* filmsLogs = tranche.getFilms();
+    std::vector<std::uint32_t> filmsVus;
+    for (std::size_t i = 0; i < tranche.getNombreEntrees(); i++)
+    {
+        if (utilisateurs[i] == indice)
         {
-            filmsVus.emplace(log.film);
+            filmsVus.push_back(filmsLogs[i]);
         }
     }
-    return std::vector<const Film*>(filmsVus.begin(), filmsVus.end());
-}
\ No newline at end of file
+    std::sort(filmsVus.begin(), filmsVus.end());
+    filmsVus.erase(std::unique(filmsVus.begin(), filmsVus.end()), filmsVus.end());
+
+    std::vector<const Film*> films;
+    films.reserve(filmsVus.size());
+    std::transform(filmsVus.begin(), filmsVus.end(), std::back_inserter(films),
+                   [this](std::uint32_t indiceFilm) { return films_[indiceFilm]; });
+    return films;
+}
+
+/// Convertit un log en sa forme compacte en attribuant au besoin un indice à son utilisateur et à son film.
+/// \param timestamp    L'horodatage du log en secondes depuis l'époque Unix.
+/// \param utilisateur  L'utilisateur du log.
+/// \param film         Le film du log.
+/// \return             L'entrée compacte correspondante.
+EntreeLog AnalyseurLogs::creerEntreeLog(std::int64_t timestamp, const Utilisateur* utilisateur, const Film* film)
+{
+    std::uint32_t indiceUtilisateur = attribuerIndice(utilisateur, utilisateurs_, debordementUtilisateurs_);
+    std::uint32_t indiceFilm = attribuerIndice(film, films_, debordementFilms_);
+    if (vuesUtilisateurs_.size() < utilisateurs_.size())
+    {
+        vuesUtilisateurs_.resize(utilisateurs_.size());
+        filmsVusUtilisateurs_.resize(utilisateurs_.size());
+    }
+    return EntreeLog{timestamp, indiceUtilisateur, indiceFilm};
+}
+
+/// Ajoute un lot d'entrées compactes: le lot est trié de façon stable puis fusionné avec les logs existants. En mode
+/// approximatif, les entrées sont seulement comptées.
+/// \param entreesLog   Les entrées à ajouter, dans leur ordre d'arrivée.
+void AnalyseurLogs::ajouterEntreesLog(std::vector<EntreeLog> entreesLog)
+{
+    if (compteurApproximatif_)
+    {
+        for (const EntreeLog& entreeLog : entreesLog)
+        {
+            comptabiliserEntreeLogApproximative(entreeLog);
+        }
+        return;
+    }
+
+    if (!std::is_sorted(entreesLog.begin(), entreesLog.end(), ComparateurLog()))
+    {
+        std::stable_sort(entreesLog.begin(), entreesLog.end(), ComparateurLog());
+    }
+
+    logs_.fusionner(entreesLog);
+    for (const EntreeLog& entreeLog : entreesLog)
+    {
+        comptabiliserEntreeLog(entreeLog);
+    }
+    if (tendances_)
+    {
+        tendances_->avancer(logs_);
+    }
+}
+
+/// Met à jour les statistiques par film et par utilisateur pour une entrée ajoutée au log.
+/// \param entreeLog    L'entrée ajoutée.
+void AnalyseurLogs::comptabiliserEntreeLog(const EntreeLog& entreeLog)
+{
+    classementFilms_.ajouterVue(entreeLog.film);
+    if (tendances_)
+    {
+        tendances_->comptabiliserEntreeLog(entreeLog);
+    }
+    if (cardinalites_)
+    {
+        cardinalites_->comptabiliserEntreeLog(entreeLog, utilisateurs_[entreeLog.utilisateur], films_[entreeLog.film]);
+    }
+    vuesUtilisateurs_[entreeLog.utilisateur]++;
+
+    std::vector<std::uint32_t>& filmsVus = filmsVusUtilisateurs_[entreeLog.utilisateur];
+    auto it = std::lower_bound(filmsVus.begin(), filmsVus.end(), entreeLog.film);
+    if (it == filmsVus.end() || *it != entreeLog.film)
+    {
+        filmsVus.insert(it, entreeLog.film);
+    }
+}
+
+/// Met à jour les estimations du mode approximatif pour une entrée, qui n'est pas conservée.
+/// \param entreeLog    L'entrée ajoutée.
+void AnalyseurLogs::comptabiliserEntreeLogApproximative(const EntreeLog& entreeLog)
+{
+    compteurApproximatif_->ajouterVue(entreeLog.film);
+    if (cardinalites_)
+    {
+        cardinalites_->comptabiliserEntreeLog(entreeLog, utilisateurs_[entreeLog.utilisateur], films_[entreeLog.film]);
+    }
+}
+
+/// Efface tous les logs ainsi que les statistiques et les tables qui en découlent. La configuration des tendances,
+/// du mode approximatif et des cardinalités est conservée.
+void AnalyseurLogs::effacer()
+{
+    logs_.effacer();
+    classementFilms_.effacer();
+    if (tendances_)
+    {
+        tendances_->effacer();
+    }
+    if (compteurApproximatif_)
+    {
+        compteurApproximatif_->effacer();
+    }
+    if (cardinalites_)
+    {
+        cardinalites_->effacer();
+    }
+    vuesUtilisateurs_.clear();
+    filmsVusUtilisateurs_.clear();
+    utilisateurs_.clear();
+    debordementUtilisateurs_.clear();
+    films_.clear();
+    debordementFilms_.clear();
+}
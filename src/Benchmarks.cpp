@@ -0,0 +1,642 @@
+/// Mesures de performance.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "Benchmarks.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "ColonnesLogs.h"
+#include "EntrepotStable.h"
+#include "Film.h"
+#include "Foncteurs.h"
+#include "GestionnaireFilms.h"
+#include "GestionnaireUtilisateurs.h"
+#include "Horodatage.h"
+#include "IndexChaines.h"
+#include "IngestionLogs.h"
+#include "LigneLog.h"
+#include "TendancesFilms.h"
+
+namespace
+{
+    /// Affiche un header pour chaque section de mesures à l'écran.
+    /// \param nomSectionBenchmark  Le nom de la section de mesures.
+    void afficherHeaderBenchmark(const std::string& nomSectionBenchmark)
+    {
+        std::cout << "\nMesures pour " + nomSectionBenchmark + ":\n--------\n";
+    }
+
+    /// Affiche le nom d'une mesure ainsi que sa valeur à l'écran.
+    /// \param nom      Le nom de la mesure.
+    /// \param valeur   La valeur mesurée.
+    /// \param unite    L'unité de la valeur.
+    void afficherResultatBenchmark(const std::string& nom, double valeur, const std::string& unite)
+    {
+        static constexpr int largeurNomMesure = 50;
+        std::cout << std::left << std::setw(largeurNomMesure) << nom << ": " << valeur << ' ' << unite << '\n';
+    }
+
+    /// Mesure la durée d'exécution d'une fonction.
+    /// \param fonction La fonction à exécuter.
+    /// \return         La durée en millisecondes.
+    template<typename Fonction>
+    double mesurerMillisecondes(Fonction&& fonction)
+    {
+        auto debut = std::chrono::steady_clock::now();
+        fonction();
+        std::chrono::duration<double, std::milli> duree = std::chrono::steady_clock::now() - debut;
+        return duree.count();
+    }
+} // namespace
+
+namespace Benchmarks
+{
+    /// Appelle toutes les mesures de performance.
+    void benchmarkAll()
+    {
+        benchmarkLignesLog();
+        benchmarkTendances();
+        benchmarkEntrepot();
+        benchmarkIndexChaines();
+        benchmarkRequetesFilms();
+        benchmarkRechercheTitres();
+        benchmarkAudienceUtilisateurs();
+        benchmarkIngestionLogs();
+    }
+
+    /// Compare l'empreinte mémoire et le temps de tri des lignes de log textuelles (LigneLog) et des entrées
+    /// compactes conservées par l'analyseur (EntreeLog).
+    void benchmarkLignesLog()
+    {
+        static constexpr std::size_t nombreLignes = 1'000'000;
+        static constexpr std::int64_t debutPeriode = 1514764800; // 2018-01-01T00:00:00Z
+        static constexpr std::int64_t dureePeriode = 3 * 365 * 86400;
+
+        afficherHeaderBenchmark("LigneLog et EntreeLog (" + std::to_string(nombreLignes) + " lignes)");
+
+        std::mt19937_64 generateur(42);
+        std::uniform_int_distribution<std::int64_t> distribution(debutPeriode, debutPeriode + dureePeriode);
+        std::vector<LigneLog> lignesLog;
+        std::vector<EntreeLog> entreesLog;
+        lignesLog.reserve(nombreLignes);
+        entreesLog.reserve(nombreLignes);
+        for (std::size_t i = 0; i < nombreLignes; i++)
+        {
+            std::int64_t timestamp = distribution(generateur);
+            lignesLog.push_back({formaterHorodatage(timestamp), nullptr, nullptr});
+            entreesLog.push_back({timestamp, 0, 0});
+        }
+
+        // Un horodatage de 20 caractères dépasse l'optimisation des petites chaînes des implémentations courantes
+        std::size_t octetsTas = 0;
+        for (const LigneLog& ligneLog : lignesLog)
+        {
+            if (ligneLog.timestamp.capacity() > std::string().capacity())
+            {
+                octetsTas += ligneLog.timestamp.capacity() + 1;
+            }
+        }
+        double octetsParLigneLog =
+            static_cast<double>(sizeof(LigneLog)) + static_cast<double>(octetsTas) / static_cast<double>(nombreLignes);
+
+        double dureeTriLignesLog =
+            mesurerMillisecondes([&]() { std::stable_sort(lignesLog.begin(), lignesLog.end(), ComparateurLog()); });
+        double dureeTriEntreesLog =
+            mesurerMillisecondes([&]() { std::stable_sort(entreesLog.begin(), entreesLog.end(), ComparateurLog()); });
+
+        afficherResultatBenchmark("Taille de LigneLog", static_cast<double>(sizeof(LigneLog)), "octets");
+        afficherResultatBenchmark("Taille de LigneLog avec son horodatage", octetsParLigneLog, "octets");
+        afficherResultatBenchmark("Taille de EntreeLog", static_cast<double>(sizeof(EntreeLog)), "octets");
+        afficherResultatBenchmark("Tri stable des LigneLog", dureeTriLignesLog, "ms");
+        afficherResultatBenchmark("Tri stable des EntreeLog", dureeTriEntreesLog, "ms");
+    }
+
+    /// Mesure le coût par vue du maintien des tendances selon la taille de l'historique déjà présent dans le log.
+    /// Le coût doit rester constant: seules les vues qui entrent dans la fenêtre ou qui en sortent sont traitées.
+    void benchmarkTendances()
+    {
+        static constexpr std::int64_t debutPeriode = 1514764800; // 2018-01-01T00:00:00Z
+        static constexpr std::int64_t dureeFenetre = 3600;
+        static constexpr std::uint32_t nombreFilms = 10'000;
+        static constexpr std::size_t nombreVuesMesurees = 100'000;
+
+        afficherHeaderBenchmark("Tendances sur une fenêtre de " + std::to_string(dureeFenetre) + " s");
+
+        for (std::size_t tailleHistorique : {std::size_t{100'000}, std::size_t{1'000'000}, std::size_t{4'000'000}})
+        {
+            std::mt19937_64 generateur(42);
+            std::uniform_int_distribution<std::uint32_t> distribution(0, nombreFilms - 1);
+            ColonnesLogs logs;
+            std::vector<EntreeLog> historique;
+            historique.reserve(tailleHistorique);
+            for (std::size_t i = 0; i < tailleHistorique; i++)
+            {
+                historique.push_back({debutPeriode + static_cast<std::int64_t>(i), 0, distribution(generateur)});
+            }
+            logs.fusionner(historique);
+            TendancesFilms tendances(dureeFenetre);
+            tendances.initialiser(logs);
+
+            double duree = mesurerMillisecondes(
+                [&]()
+                {
+                    for (std::size_t i = 0; i < nombreVuesMesurees; i++)
+                    {
+                        EntreeLog entreeLog{debutPeriode + static_cast<std::int64_t>(tailleHistorique + i), 0,
+                                            distribution(generateur)};
+                        logs.inserer(entreeLog);
+                        tendances.comptabiliserEntreeLog(entreeLog);
+                        tendances.avancer(logs);
+                    }
+                });
+            afficherResultatBenchmark("Vue avec un historique de " + std::to_string(tailleHistorique),
+                                      duree * 1e6 / static_cast<double>(nombreVuesMesurees), "ns");
+        }
+    }
+
+    /// Compare le chargement, la copie, le parcours et la destruction d'un grand catalogue de films alloués un par un
+    /// (std::vector de std::unique_ptr) et rangés par blocs dans un EntrepotStable.
+    void benchmarkEntrepot()
+    {
+        static constexpr std::size_t nombreFilms = 1'000'000;
+
+        afficherHeaderBenchmark("Catalogue de " + std::to_string(nombreFilms) + " films");
+
+        std::vector<Film> films;
+        films.reserve(nombreFilms);
+        for (std::size_t i = 0; i < nombreFilms; i++)
+        {
+            films.push_back(Film{"Film " + std::to_string(i), static_cast<Film::Genre>(i % Film::nombreGenres),
+                                 Pays::Canada, ChaineInternee("Réalisateur"), 2000, static_cast<std::uint32_t>(i)});
+        }
+
+        std::uint64_t sommeIndices = 0;
+        {
+            std::vector<std::unique_ptr<Film>> pointeurs;
+            std::vector<std::unique_ptr<Film>> copie;
+            double dureeChargement = mesurerMillisecondes(
+                [&]()
+                {
+                    pointeurs.reserve(nombreFilms);
+                    for (const Film& film : films)
+                    {
+                        pointeurs.push_back(std::make_unique<Film>(film));
+                    }
+                });
+            double dureeCopie = mesurerMillisecondes(
+                [&]()
+                {
+                    copie.reserve(nombreFilms);
+                    for (const auto& film : pointeurs)
+                    {
+                        copie.push_back(std::make_unique<Film>(*film));
+                    }
+                });
+            double dureeParcours = mesurerMillisecondes(
+                [&]()
+                {
+                    for (const auto& film : copie)
+                    {
+                        sommeIndices += film->indice;
+                    }
+                });
+            double dureeDestruction = mesurerMillisecondes(
+                [&]()
+                {
+                    pointeurs.clear();
+                    copie.clear();
+                });
+            afficherResultatBenchmark("Chargement avec std::unique_ptr", dureeChargement, "ms");
+            afficherResultatBenchmark("Copie avec std::unique_ptr", dureeCopie, "ms");
+            afficherResultatBenchmark("Parcours avec std::unique_ptr", dureeParcours, "ms");
+            afficherResultatBenchmark("Destruction de deux catalogues std::unique_ptr", dureeDestruction, "ms");
+        }
+        {
+            EntrepotStable<Film> entrepot;
+            EntrepotStable<Film> copie;
+            double dureeChargement = mesurerMillisecondes(
+                [&]()
+                {
+                    entrepot.reserver(nombreFilms);
+                    for (const Film& film : films)
+                    {
+                        entrepot.creer(film);
+                    }
+                });
+            double dureeCopie = mesurerMillisecondes(
+                [&]()
+                {
+                    copie.reserver(nombreFilms);
+                    entrepot.pourChaque([&copie](const Film& film) { copie.creer(film); });
+                });
+            double dureeParcours = mesurerMillisecondes(
+                [&]() { copie.pourChaque([&sommeIndices](const Film& film) { sommeIndices += film.indice; }); });
+            double dureeDestruction = mesurerMillisecondes(
+                [&]()
+                {
+                    entrepot.effacer();
+                    copie.effacer();
+                });
+            afficherResultatBenchmark("Chargement avec EntrepotStable", dureeChargement, "ms");
+            afficherResultatBenchmark("Copie avec EntrepotStable", dureeCopie, "ms");
+            afficherResultatBenchmark("Parcours avec EntrepotStable", dureeParcours, "ms");
+            afficherResultatBenchmark("Destruction de deux catalogues EntrepotStable", dureeDestruction, "ms");
+        }
+        // La somme est affichée pour que les parcours ne soient pas éliminés par l'optimiseur
+        afficherResultatBenchmark("Somme des indices parcourus", static_cast<double>(sommeIndices), "");
+    }
+
+    /// Compare les recherches par nom dans un std::unordered_map de std::string, qui demande de construire une
+    /// std::string à partir de chaque nom lu dans un tampon, et dans un IndexChaines interrogé directement avec des
+    /// std::string_view, pour des noms présents et absents.
+    void benchmarkIndexChaines()
+    {
+        static constexpr std::size_t nombreCles = 2'000'000;
+        static constexpr std::size_t nombreRecherches = 4'000'000;
+
+        afficherHeaderBenchmark("Index de " + std::to_string(nombreCles) + " noms");
+
+        std::vector<Film> films(nombreCles);
+        std::unordered_map<std::string, const Film*> tableNoeuds;
+        IndexChaines<const Film> indexChaines;
+        tableNoeuds.reserve(nombreCles);
+        indexChaines.reserver(nombreCles);
+        for (std::size_t i = 0; i < nombreCles; i++)
+        {
+            films[i].nom = "Film numéro " + std::to_string(i);
+            tableNoeuds.emplace(films[i].nom, &films[i]);
+            indexChaines.inserer(films[i].nom, &films[i]);
+        }
+
+        // Les noms cherchés sont des tranches d'un tampon, comme lors de l'interprétation d'un fichier. Les noms
+        // présents et absents sont mesurés séparément: un échec parcourt toute la sonde ou l'alvéole, pas un succès
+        std::mt19937_64 generateur(42);
+        auto creerNoms = [&generateur](std::size_t premier, std::size_t dernier, std::string& tampon)
+        {
+            std::uniform_int_distribution<std::size_t> distribution(premier, dernier);
+            std::vector<std::pair<std::size_t, std::size_t>> tranches;
+            for (std::size_t i = 0; i < nombreRecherches; i++)
+            {
+                std::string nom = "Film numéro " + std::to_string(distribution(generateur));
+                tranches.emplace_back(tampon.size(), nom.size());
+                tampon += nom;
+            }
+            std::vector<std::string_view> noms;
+            for (auto [debut, taille] : tranches)
+            {
+                noms.push_back(std::string_view(tampon).substr(debut, taille));
+            }
+            return noms;
+        };
+        std::string tamponPresents;
+        std::string tamponAbsents;
+        std::vector<std::string_view> nomsPresents = creerNoms(0, nombreCles - 1, tamponPresents);
+        std::vector<std::string_view> nomsAbsents = creerNoms(nombreCles, 2 * nombreCles - 1, tamponAbsents);
+
+        // Retourne la durée moyenne d'une recherche en nanosecondes et ajoute le nombre de noms trouvés au compteur
+        auto mesurerRecherches = [](const std::vector<std::string_view>& noms, auto trouver, std::size_t& trouves)
+        {
+            double duree = mesurerMillisecondes(
+                [&]()
+                {
+                    for (std::string_view nom : noms)
+                    {
+                        trouves += trouver(nom);
+                    }
+                });
+            return duree * 1e6 / static_cast<double>(noms.size());
+        };
+        auto trouverNoeuds = [&tableNoeuds](std::string_view nom)
+        { return std::size_t{tableNoeuds.find(std::string(nom)) != tableNoeuds.end()}; };
+        auto trouverIndex = [&indexChaines](std::string_view nom)
+        { return std::size_t{indexChaines.trouver(nom) != nullptr}; };
+
+        std::size_t presentsNoeuds = 0;
+        std::size_t presentsIndex = 0;
+        std::size_t absentsNoeuds = 0;
+        std::size_t absentsIndex = 0;
+        double dureePresentsNoeuds = mesurerRecherches(nomsPresents, trouverNoeuds, presentsNoeuds);
+        double dureePresentsIndex = mesurerRecherches(nomsPresents, trouverIndex, presentsIndex);
+        double dureeAbsentsNoeuds = mesurerRecherches(nomsAbsents, trouverNoeuds, absentsNoeuds);
+        double dureeAbsentsIndex = mesurerRecherches(nomsAbsents, trouverIndex, absentsIndex);
+        afficherResultatBenchmark("Succès de recherche std::unordered_map", dureePresentsNoeuds, "ns");
+        afficherResultatBenchmark("Succès de recherche IndexChaines", dureePresentsIndex, "ns");
+        afficherResultatBenchmark("Échec de recherche std::unordered_map", dureeAbsentsNoeuds, "ns");
+        afficherResultatBenchmark("Échec de recherche IndexChaines", dureeAbsentsIndex, "ns");
+        afficherResultatBenchmark("Résultats identiques",
+                                  presentsNoeuds == nombreRecherches && presentsIndex == nombreRecherches &&
+                                          absentsNoeuds == 0 && absentsIndex == 0
+                                      ? 1.0
+                                      : 0.0,
+                                  "");
+    }
+
+    /// Compare une requête sur trois critères évaluée par rechercherFilms et par l'intersection naïve des filtres
+    /// existants: les vecteurs de chaque critère sont copiés, triés en ordre d'ajout puis intersectés.
+    void benchmarkRequetesFilms()
+    {
+        static constexpr std::size_t nombreFilms = 1'000'000;
+        static constexpr int nombreRepetitions = 10;
+
+        afficherHeaderBenchmark("Requête sur " + std::to_string(nombreFilms) + " films");
+
+        GestionnaireFilms gestionnaireFilms;
+        std::mt19937_64 generateur(42);
+        for (std::size_t i = 0; i < nombreFilms; i++)
+        {
+            gestionnaireFilms.ajouterFilm(Film{"Film " + std::to_string(i),
+                                               static_cast<Film::Genre>(generateur() % Film::nombreGenres),
+                                               static_cast<Pays>(generateur() % nombrePays),
+                                               ChaineInternee("Réalisateur " + std::to_string(generateur() % 1000)),
+                                               1950 + static_cast<int>(generateur() % 70)});
+        }
+        RequeteFilms requete;
+        requete.genres = {Film::Genre::Action, Film::Genre::Comedie, Film::Genre::Drame};
+        requete.pays = {Pays::Canada, Pays::France, Pays::Japon};
+        requete.anneeDebut = 1990;
+        requete.anneeFin = 2005;
+
+        auto parIndice = [](const Film* film1, const Film* film2) { return film1->indice < film2->indice; };
+        std::vector<const Film*> filmsNaifs;
+        double dureeNaive = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    std::vector<const Film*> filmsGenres;
+                    for (Film::Genre genre : requete.genres)
+                    {
+                        VueFilms filmsGenre = gestionnaireFilms.getFilmsParGenre(genre);
+                        filmsGenres.insert(filmsGenres.end(), filmsGenre.begin(), filmsGenre.end());
+                    }
+                    std::vector<const Film*> filmsPays;
+                    for (Pays pays : requete.pays)
+                    {
+                        VueFilms filmsUnPays = gestionnaireFilms.getFilmsParPays(pays);
+                        filmsPays.insert(filmsPays.end(), filmsUnPays.begin(), filmsUnPays.end());
+                    }
+                    std::vector<const Film*> filmsAnnees =
+                        gestionnaireFilms.getFilmsEntreAnnees(requete.anneeDebut, requete.anneeFin);
+                    std::sort(filmsGenres.begin(), filmsGenres.end(), parIndice);
+                    std::sort(filmsPays.begin(), filmsPays.end(), parIndice);
+                    std::sort(filmsAnnees.begin(), filmsAnnees.end(), parIndice);
+
+                    std::vector<const Film*> filmsGenresPays;
+                    std::set_intersection(filmsGenres.begin(), filmsGenres.end(), filmsPays.begin(), filmsPays.end(),
+                                          std::back_inserter(filmsGenresPays), parIndice);
+                    filmsNaifs.clear();
+                    std::set_intersection(filmsGenresPays.begin(), filmsGenresPays.end(), filmsAnnees.begin(),
+                                          filmsAnnees.end(), std::back_inserter(filmsNaifs), parIndice);
+                }
+            });
+        std::vector<const Film*> filmsRequete;
+        double dureeRequete = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    filmsRequete = gestionnaireFilms.rechercherFilms(requete);
+                }
+            });
+        afficherResultatBenchmark("Intersection naïve des filtres", dureeNaive / nombreRepetitions, "ms");
+        afficherResultatBenchmark("GestionnaireFilms::rechercherFilms", dureeRequete / nombreRepetitions, "ms");
+        afficherResultatBenchmark("Films retenus", static_cast<double>(filmsRequete.size()), "");
+        afficherResultatBenchmark("Résultats identiques", filmsNaifs == filmsRequete ? 1.0 : 0.0, "");
+    }
+
+    /// Compare la recherche de films par sous-chaîne et par préfixe du titre avec un parcours de tous les films, comme
+    /// celui que faisait la boîte de recherche à chaque touche.
+    void benchmarkRechercheTitres()
+    {
+        static constexpr std::size_t nombreFilms = 1'000'000;
+        static constexpr int nombreRepetitions = 10;
+        static constexpr std::array<std::string_view, 8> mots = {"Le",      "Retour", "du",     "Roi",
+                                                                 "Matrice", "Nuit",   "Étoile", "Perdue"};
+
+        afficherHeaderBenchmark("Recherche par titre sur " + std::to_string(nombreFilms) + " films");
+
+        GestionnaireFilms gestionnaireFilms;
+        std::mt19937_64 generateur(42);
+        for (std::size_t i = 0; i < nombreFilms; i++)
+        {
+            std::string titre(mots[generateur() % mots.size()]);
+            titre.append(" ").append(mots[generateur() % mots.size()]).append(" ").append(std::to_string(i));
+            gestionnaireFilms.ajouterFilm(
+                Film{titre, Film::Genre::Action, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        }
+        std::vector<const Film*> films = gestionnaireFilms.rechercherFilms(RequeteFilms());
+
+        for (std::string_view recherche :
+             {std::string_view("nuit 4242"), std::string_view("Étoile perdue 99"), std::string_view("42")})
+        {
+            std::vector<const Film*> filmsParcours;
+            double dureeParcours = mesurerMillisecondes(
+                [&]()
+                {
+                    for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                    {
+                        filmsParcours.clear();
+                        std::string rechercheMinuscules(recherche);
+                        std::transform(rechercheMinuscules.begin(), rechercheMinuscules.end(),
+                                       rechercheMinuscules.begin(), [](unsigned char c) { return std::tolower(c); });
+                        for (const Film* film : films)
+                        {
+                            std::string nom = film->nom;
+                            std::transform(nom.begin(), nom.end(), nom.begin(),
+                                           [](unsigned char c) { return std::tolower(c); });
+                            if (nom.find(rechercheMinuscules) != std::string::npos)
+                            {
+                                filmsParcours.push_back(film);
+                            }
+                        }
+                    }
+                });
+            std::vector<const Film*> filmsIndex;
+            double dureeIndex = mesurerMillisecondes(
+                [&]()
+                {
+                    for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                    {
+                        filmsIndex = gestionnaireFilms.rechercherFilmsParSousChaine(recherche);
+                    }
+                });
+            afficherResultatBenchmark("Parcours pour \"" + std::string(recherche) + "\"",
+                                      dureeParcours / nombreRepetitions, "ms");
+            afficherResultatBenchmark("Sous-chaîne \"" + std::string(recherche) + "\"",
+                                      dureeIndex / nombreRepetitions, "ms");
+            afficherResultatBenchmark("Résultats identiques", filmsParcours == filmsIndex ? 1.0 : 0.0, "");
+        }
+
+        std::vector<const Film*> filmsPrefixe;
+        double dureePrefixe = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    filmsPrefixe = gestionnaireFilms.rechercherFilmsParPrefixe("roi matrice 12", 10);
+                }
+            });
+        afficherResultatBenchmark("Préfixe \"roi matrice 12\" (10 premiers)", dureePrefixe / nombreRepetitions, "ms");
+        afficherResultatBenchmark("Films retenus", static_cast<double>(filmsPrefixe.size()), "");
+    }
+
+    /// Compare le dénombrement et l'énumération d'une audience (un pays et une tranche d'âge) par les filtres du
+    /// gestionnaire d'utilisateurs avec un parcours de tous les utilisateurs.
+    void benchmarkAudienceUtilisateurs()
+    {
+        static constexpr std::size_t nombreUtilisateurs = 1'000'000;
+        static constexpr int nombreRepetitions = 10;
+
+        afficherHeaderBenchmark("Audience sur " + std::to_string(nombreUtilisateurs) + " utilisateurs");
+
+        GestionnaireUtilisateurs gestionnaireUtilisateurs;
+        std::mt19937_64 generateur(42);
+        for (std::size_t i = 0; i < nombreUtilisateurs; i++)
+        {
+            gestionnaireUtilisateurs.ajouterUtilisateur(Utilisateur{"id" + std::to_string(i) + "@email.com", "Nom",
+                                                                    13 + static_cast<int>(generateur() % 70),
+                                                                    static_cast<Pays>(generateur() % nombrePays)});
+        }
+        std::vector<const Utilisateur*> utilisateurs = gestionnaireUtilisateurs.getUtilisateursEntreAges(0, 200);
+
+        std::size_t nombreParcours = 0;
+        double dureeParcours = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    nombreParcours = static_cast<std::size_t>(
+                        std::count_if(utilisateurs.begin(), utilisateurs.end(),
+                                      [](const Utilisateur* utilisateur)
+                                      {
+                                          return utilisateur->pays == Pays::Japon && utilisateur->age >= 18 &&
+                                                 utilisateur->age <= 24;
+                                      }));
+                }
+            });
+        std::size_t nombreHistogramme = 0;
+        double dureeHistogramme = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    nombreHistogramme = gestionnaireUtilisateurs.getNombreUtilisateursParPays(Pays::Japon, 18, 24);
+                }
+            });
+        std::vector<const Utilisateur*> utilisateursAudience;
+        double dureeEnumeration = mesurerMillisecondes(
+            [&]()
+            {
+                for (int repetition = 0; repetition < nombreRepetitions; repetition++)
+                {
+                    utilisateursAudience = gestionnaireUtilisateurs.getUtilisateursParPays(Pays::Japon, 18, 24);
+                }
+            });
+        afficherResultatBenchmark("Parcours de tous les utilisateurs", dureeParcours / nombreRepetitions, "ms");
+        afficherResultatBenchmark("Dénombrement par l'histogramme", dureeHistogramme / nombreRepetitions, "ms");
+        afficherResultatBenchmark("Énumération par le filtre", dureeEnumeration / nombreRepetitions, "ms");
+        afficherResultatBenchmark("Utilisateurs retenus", static_cast<double>(nombreHistogramme), "");
+        afficherResultatBenchmark("Résultats identiques",
+                                  nombreParcours == nombreHistogramme &&
+                                          utilisateursAudience.size() == nombreHistogramme
+                                      ? 1.0
+                                      : 0.0,
+                                  "");
+    }
+
+    /// Mesure le débit de l'ingestion concurrente de logs selon le nombre de threads producteurs, comparé à l'ajout
+    /// ligne par ligne d'un seul thread. Les horodatages arrivent presque en ordre, comme ceux d'un flux réel.
+    void benchmarkIngestionLogs()
+    {
+        static constexpr std::size_t nombreLignes = 1'000'000;
+        static constexpr std::size_t nombreElements = 1000;
+        static constexpr std::int64_t debutPeriode = 1514764800; // 2018-01-01T00:00:00Z
+
+        afficherHeaderBenchmark("Ingestion de " + std::to_string(nombreLignes) + " logs");
+
+        GestionnaireUtilisateurs gestionnaireUtilisateurs;
+        GestionnaireFilms gestionnaireFilms;
+        std::vector<const Utilisateur*> utilisateurs;
+        std::vector<const Film*> films;
+        for (std::size_t i = 0; i < nombreElements; i++)
+        {
+            std::string id = "id" + std::to_string(i) + "@email.com";
+            gestionnaireUtilisateurs.ajouterUtilisateur(Utilisateur{id, "Nom", 30, Pays::Canada});
+            utilisateurs.push_back(gestionnaireUtilisateurs.getUtilisateurParId(id));
+            std::string nom = "Film " + std::to_string(i);
+            gestionnaireFilms.ajouterFilm(
+                Film{nom, Film::Genre::Action, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+            films.push_back(gestionnaireFilms.getFilmParNom(nom));
+        }
+        std::mt19937_64 generateur(42);
+        std::vector<LigneLog> lignesLog;
+        lignesLog.reserve(nombreLignes);
+        for (std::size_t i = 0; i < nombreLignes; i++)
+        {
+            std::int64_t timestamp = debutPeriode + static_cast<std::int64_t>(i / 4 + generateur() % 8);
+            lignesLog.push_back({formaterHorodatage(timestamp), utilisateurs[generateur() % nombreElements],
+                                 films[generateur() % nombreElements]});
+        }
+
+        AnalyseurLogs analyseurSequentiel;
+        double dureeSequentielle = mesurerMillisecondes(
+            [&]()
+            {
+                for (const LigneLog& ligneLog : lignesLog)
+                {
+                    analyseurSequentiel.ajouterLigneLog(ligneLog);
+                }
+            });
+        afficherResultatBenchmark("ajouterLigneLog sur un thread",
+                                  static_cast<double>(nombreLignes) / dureeSequentielle / 1000.0, "M logs/s");
+
+        // Au-delà du nombre de coeurs, les producteurs se partagent les coeurs avec le thread de fusion
+        for (std::size_t nombreProducteurs : {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{8}})
+        {
+            AnalyseurLogs analyseurConcurrent;
+            bool resultatsIdentiques = false;
+            double duree = mesurerMillisecondes(
+                [&]()
+                {
+                    IngestionLogs ingestion(analyseurConcurrent);
+                    std::vector<std::thread> producteurs;
+                    for (std::size_t i = 0; i < nombreProducteurs; i++)
+                    {
+                        producteurs.emplace_back(
+                            [&, i]()
+                            {
+                                for (std::size_t j = i; j < nombreLignes; j += nombreProducteurs)
+                                {
+                                    ingestion.ajouterLigneLog(lignesLog[j]);
+                                }
+                            });
+                    }
+                    for (std::thread& producteur : producteurs)
+                    {
+                        producteur.join();
+                    }
+                    ingestion.vider();
+                    resultatsIdentiques = ingestion.getNombreLignesIngerees() == nombreLignes;
+                });
+            resultatsIdentiques = resultatsIdentiques &&
+                                  analyseurConcurrent.getNombreLignesLog() == analyseurSequentiel.getNombreLignesLog() &&
+                                  analyseurConcurrent.getNFilmsPlusPopulaires(10) ==
+                                      analyseurSequentiel.getNFilmsPlusPopulaires(10);
+            afficherResultatBenchmark("IngestionLogs avec " + std::to_string(nombreProducteurs) + " producteurs",
+                                      static_cast<double>(nombreLignes) / duree / 1000.0, "M logs/s");
+            afficherResultatBenchmark("Résultats identiques", resultatsIdentiques ? 1.0 : 0.0, "");
+        }
+    }
+} // namespace Benchmarks
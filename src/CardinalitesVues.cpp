@@ -0,0 +1,80 @@
+/// Nombre estimé de spectateurs et de films distincts.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "CardinalitesVues.h"
+
+/// Constructeur à partir de la précision des esquisses.
+/// \param precision    La précision p de chaque esquisse, qui occupe 2^p octets.
+CardinalitesVues::CardinalitesVues(std::uint8_t precision)
+    : precision_(HyperLogLog(precision).getPrecision())
+    , spectateursPays_(nombrePays, HyperLogLog(precision_))
+{
+}
+
+/// Ajoute une vue aux esquisses de son film, de son utilisateur et du pays de son utilisateur, en O(1) amorti.
+/// \param entreeLog    L'entrée ajoutée au log, dont les indices désignent les esquisses à mettre à jour.
+/// \param utilisateur  L'utilisateur de l'entrée, dont l'identifiant est la clé ajoutée et dont le pays est utilisé
+///                     s'il est valide.
+/// \param film         Le film de l'entrée, dont l'identifiant est la clé ajoutée.
+void CardinalitesVues::comptabiliserEntreeLog(const EntreeLog& entreeLog, const Utilisateur* utilisateur,
+                                              const Film* film)
+{
+    if (entreeLog.film >= spectateursFilms_.size())
+    {
+        spectateursFilms_.resize(entreeLog.film + std::size_t{1}, HyperLogLog(precision_));
+    }
+    if (entreeLog.utilisateur >= filmsUtilisateurs_.size())
+    {
+        filmsUtilisateurs_.resize(entreeLog.utilisateur + std::size_t{1}, HyperLogLog(precision_));
+    }
+    spectateursFilms_[entreeLog.film].ajouter(utilisateur->indice);
+    filmsUtilisateurs_[entreeLog.utilisateur].ajouter(film->indice);
+    if (estPaysValide(utilisateur->pays))
+    {
+        spectateursPays_[static_cast<std::size_t>(utilisateur->pays)].ajouter(utilisateur->indice);
+    }
+}
+
+/// Retire toutes les clés des esquisses en conservant la précision.
+void CardinalitesVues::effacer()
+{
+    spectateursFilms_.clear();
+    filmsUtilisateurs_.clear();
+    for (HyperLogLog& spectateurs : spectateursPays_)
+    {
+        spectateurs.effacer();
+    }
+}
+
+/// Retourne la précision des esquisses.
+/// \return La précision p.
+std::uint8_t CardinalitesVues::getPrecision() const
+{
+    return precision_;
+}
+
+/// Retourne l'esquisse des utilisateurs distincts d'un film.
+/// \param indiceFilm   L'indice du film.
+/// \return             L'esquisse, ou nullptr si aucune esquisse n'a encore été créée pour ce film.
+const HyperLogLog* CardinalitesVues::getSpectateursFilm(std::uint32_t indiceFilm) const
+{
+    return indiceFilm < spectateursFilms_.size() ? &spectateursFilms_[indiceFilm] : nullptr;
+}
+
+/// Retourne l'esquisse des films distincts vus par un utilisateur.
+/// \param indiceUtilisateur    L'indice de l'utilisateur.
+/// \return                     L'esquisse, ou nullptr si aucune esquisse n'a encore été créée pour cet
+///                             utilisateur.
+const HyperLogLog* CardinalitesVues::getFilmsUtilisateur(std::uint32_t indiceUtilisateur) const
+{
+    return indiceUtilisateur < filmsUtilisateurs_.size() ? &filmsUtilisateurs_[indiceUtilisateur] : nullptr;
+}
+
+/// Retourne l'esquisse des utilisateurs distincts d'un pays ayant vu au moins un film.
+/// \param pays Le pays.
+/// \return     L'esquisse, ou nullptr si le pays ne correspond à aucune valeur du enum.
+const HyperLogLog* CardinalitesVues::getSpectateursPays(Pays pays) const
+{
+    return estPaysValide(pays) ? &spectateursPays_[static_cast<std::size_t>(pays)] : nullptr;
+}
@@ -0,0 +1,135 @@
+/// Catalogue de films lisible par plusieurs threads pendant ses modifications.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "CatalogueConcurrent.h"
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+// Toutes les opérations atomiques utilisent l'ordre séquentiellement cohérent: la récupération repose sur le fait
+// qu'un lecteur qui affiche son époque avant de lire la version courante est forcément vu par un écrivain qui remplace
+// la version avant de parcourir les emplacements.
+
+/// Termine la lecture et libère son emplacement.
+CatalogueConcurrent::Lecture::~Lecture()
+{
+    emplacement_.store(emplacementLibre);
+}
+
+/// Donne accès à la version lue.
+/// \return La version, qui ne sera pas modifiée.
+const GestionnaireFilms& CatalogueConcurrent::Lecture::operator*() const
+{
+    return *version_;
+}
+
+/// Donne accès à la version lue.
+/// \return La version, qui ne sera pas modifiée.
+const GestionnaireFilms* CatalogueConcurrent::Lecture::operator->() const
+{
+    return version_;
+}
+
+/// Constructeur d'une lecture dont l'emplacement affiche déjà son époque.
+/// \param emplacement  L'emplacement réservé par la lecture.
+/// \param version      La version lue.
+CatalogueConcurrent::Lecture::Lecture(std::atomic<std::uint64_t>& emplacement, const GestionnaireFilms* version)
+    : emplacement_(emplacement)
+    , version_(version)
+{
+}
+
+/// Constructeur qui publie une première version.
+/// \param films    Le contenu initial du catalogue.
+CatalogueConcurrent::CatalogueConcurrent(GestionnaireFilms films)
+    : versionCourante_(new GestionnaireFilms(std::move(films)))
+{
+}
+
+/// Destructeur. Aucune lecture ne doit être active.
+CatalogueConcurrent::~CatalogueConcurrent()
+{
+    delete versionCourante_.load();
+}
+
+/// Commence une lecture de la version courante sans prendre de verrou. Si les nombreEmplacements emplacements sont
+/// tous occupés, attend qu'une autre lecture se termine.
+/// \return La lecture, à garder tant que la version ou ses films sont utilisés.
+CatalogueConcurrent::Lecture CatalogueConcurrent::lire() const
+{
+    // Chaque thread commence sa recherche à un emplacement différent pour limiter les collisions
+    std::size_t depart = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (;;)
+    {
+        for (std::size_t i = 0; i < nombreEmplacements; i++)
+        {
+            std::atomic<std::uint64_t>& emplacement = emplacements_[(depart + i) % nombreEmplacements].epoque;
+            std::uint64_t libre = emplacementLibre;
+            std::uint64_t epoque = epoque_.load();
+            if (emplacement.load() == emplacementLibre && emplacement.compare_exchange_strong(libre, epoque))
+            {
+                // L'époque affichée doit être à jour au moment où la version est lue
+                for (std::uint64_t epoqueActuelle = epoque_.load(); epoqueActuelle != epoque;
+                     epoqueActuelle = epoque_.load())
+                {
+                    epoque = epoqueActuelle;
+                    emplacement.store(epoque);
+                }
+                return Lecture(emplacement, versionCourante_.load());
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+/// Ajoute un film dans une nouvelle version du catalogue.
+/// \param film Le film à ajouter.
+/// \return     True si le film a été ajouté, false si un film du même nom existe déjà.
+bool CatalogueConcurrent::ajouterFilm(const Film& film)
+{
+    return modifier([&film](GestionnaireFilms& films) { return films.ajouterFilm(film); });
+}
+
+/// Supprime un film dans une nouvelle version du catalogue.
+/// \param nomFilm  Le nom du film à supprimer.
+/// \return         True si le film a été supprimé, false s'il n'existe pas.
+bool CatalogueConcurrent::supprimerFilm(std::string_view nomFilm)
+{
+    return modifier([nomFilm](GestionnaireFilms& films) { return films.supprimerFilm(nomFilm); });
+}
+
+/// Retourne le nombre de versions remplacées qui attendent la fin des lectures qui peuvent les utiliser.
+/// \return Le nombre de versions retirées pas encore détruites.
+std::size_t CatalogueConcurrent::getNombreVersionsRetirees() const
+{
+    std::lock_guard verrou(mutexEcriture_);
+    return versionsRetirees_.size();
+}
+
+/// Remplace la version courante, la retire à l'époque courante puis passe à l'époque suivante. Doit être appelée avec
+/// le mutex d'écriture.
+/// \param version  La nouvelle version.
+void CatalogueConcurrent::publier(std::unique_ptr<GestionnaireFilms> version)
+{
+    const GestionnaireFilms* ancienneVersion = versionCourante_.exchange(version.release());
+    versionsRetirees_.emplace_back(epoque_.load(), ancienneVersion);
+    epoque_.fetch_add(1);
+    recupererVersions();
+}
+
+/// Détruit les versions retirées avant l'époque de la plus ancienne lecture active. Une lecture qui a affiché une
+/// époque plus récente que le retrait d'une version a forcément lu une version plus récente. Doit être appelée avec le
+/// mutex d'écriture.
+void CatalogueConcurrent::recupererVersions()
+{
+    std::uint64_t epoqueMinimale = emplacementLibre;
+    for (const Emplacement& emplacement : emplacements_)
+    {
+        epoqueMinimale = std::min(epoqueMinimale, emplacement.epoque.load());
+    }
+    auto premiereConservee =
+        std::find_if(versionsRetirees_.begin(), versionsRetirees_.end(),
+                     [epoqueMinimale](const auto& versionRetiree) { return versionRetiree.first >= epoqueMinimale; });
+    versionsRetirees_.erase(versionsRetirees_.begin(), premiereConservee);
+}
@@ -0,0 +1,152 @@
+/// Chaînes de caractères internées.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "ChaineInternee.h"
+#include <mutex>
+#include <shared_mutex>
+#include "EntrepotStable.h"
+#include "IndexChaines.h"
+
+/// Réservoir de toutes les chaînes internées. Les recherches prennent un verrou partagé; seul l'ajout d'une nouvelle
+/// chaîne prend le verrou exclusif.
+struct ChaineInternee::Reservoir
+{
+    std::shared_mutex mutex;
+    EntrepotStable<Entree> entrees; // Adresses stables pour les clés de l'index et les ChaineInternee
+    IndexChaines<const Entree> index;
+    std::uint32_t nombreEntrees = 0;
+};
+
+/// Constructeur par défaut, qui désigne la chaîne vide.
+ChaineInternee::ChaineInternee()
+{
+    static const Entree* const chaineVide = interner("");
+    entree_ = chaineVide;
+}
+
+/// Constructeur qui interne une chaîne si elle ne l'est pas déjà.
+/// \param chaine   La chaîne.
+ChaineInternee::ChaineInternee(std::string_view chaine)
+    : entree_(interner(chaine))
+{
+}
+
+/// Constructeur qui interne une chaîne si elle ne l'est pas déjà.
+/// \param chaine   La chaîne.
+ChaineInternee::ChaineInternee(const std::string& chaine)
+    : entree_(interner(chaine))
+{
+}
+
+/// Constructeur qui interne une chaîne si elle ne l'est pas déjà.
+/// \param chaine   La chaîne, terminée par un caractère nul.
+ChaineInternee::ChaineInternee(const char* chaine)
+    : entree_(interner(chaine))
+{
+}
+
+/// Cherche une chaîne déjà internée, sans l'interner si elle ne l'est pas, pour les recherches et les comparaisons
+/// avec des chaînes qui ne seront pas conservées.
+/// \param chaine   La chaîne à chercher.
+/// \return         La chaîne internée, ou std::nullopt si aucune chaîne de ce contenu n'a été internée.
+std::optional<ChaineInternee> ChaineInternee::trouver(std::string_view chaine)
+{
+    Reservoir& reservoir = getReservoir();
+    const Entree* entree = nullptr;
+    {
+        std::shared_lock verrou(reservoir.mutex);
+        entree = reservoir.index.trouver(chaine);
+    }
+    if (!entree)
+    {
+        return std::nullopt;
+    }
+    // Le constructeur par défaut peut interner la chaîne vide: il ne doit pas être appelé sous le verrou
+    ChaineInternee chaineInternee;
+    chaineInternee.entree_ = entree;
+    return chaineInternee;
+}
+
+/// Retourne le nombre de chaînes internées, qui borne leurs identifiants.
+/// \return Le nombre de chaînes internées depuis le début du programme.
+std::uint32_t ChaineInternee::getNombreChaines()
+{
+    Reservoir& reservoir = getReservoir();
+    std::shared_lock verrou(reservoir.mutex);
+    return reservoir.nombreEntrees;
+}
+
+/// Retourne la chaîne désignée.
+/// \return La copie partagée de la chaîne, valide jusqu'à la fin du programme.
+const std::string& ChaineInternee::get() const
+{
+    return entree_->chaine;
+}
+
+/// Retourne l'identifiant de la chaîne, le même pour toutes les chaînes internées de même contenu.
+/// \return L'identifiant, inférieur à getNombreChaines().
+std::uint32_t ChaineInternee::getIdentifiant() const
+{
+    return entree_->identifiant;
+}
+
+/// Retourne le réservoir partagé, créé à sa première utilisation.
+/// \return Le réservoir.
+ChaineInternee::Reservoir& ChaineInternee::getReservoir()
+{
+    static Reservoir reservoir;
+    return reservoir;
+}
+
+/// Trouve l'entrée d'une chaîne dans le réservoir ou l'y ajoute.
+/// \param chaine   La chaîne.
+/// \return         L'entrée de la chaîne, qui n'est jamais libérée.
+const ChaineInternee::Entree* ChaineInternee::interner(std::string_view chaine)
+{
+    Reservoir& reservoir = getReservoir();
+    {
+        std::shared_lock verrou(reservoir.mutex);
+        if (const Entree* entree = reservoir.index.trouver(chaine))
+        {
+            return entree;
+        }
+    }
+
+    // Un autre thread peut avoir ajouté la chaîne entre les deux verrous
+    std::unique_lock verrou(reservoir.mutex);
+    if (const Entree* entree = reservoir.index.trouver(chaine))
+    {
+        return entree;
+    }
+    const Entree* entree = reservoir.entrees.creer(Entree{std::string(chaine), reservoir.nombreEntrees++});
+    reservoir.index.inserer(entree->chaine, entree);
+    return entree;
+}
+
+/// Compare deux chaînes internées par leur identité.
+/// \param chaine1  Une des deux chaînes à comparer.
+/// \param chaine2  Une des deux chaînes à comparer.
+/// \return         True si les deux chaînes ont le même contenu.
+bool operator==(const ChaineInternee& chaine1, const ChaineInternee& chaine2)
+{
+    return chaine1.getIdentifiant() == chaine2.getIdentifiant();
+}
+
+/// Compare deux chaînes internées par leur identité.
+/// \param chaine1  Une des deux chaînes à comparer.
+/// \param chaine2  Une des deux chaînes à comparer.
+/// \return         True si les deux chaînes diffèrent.
+bool operator!=(const ChaineInternee& chaine1, const ChaineInternee& chaine2)
+{
+    return !(chaine1 == chaine2);
+}
+
+/// Écrit une chaîne internée dans un stream.
+/// \param outputStream Le stream auquel écrire la chaîne.
+/// \param chaine       La chaîne à écrire.
+/// \return             Une référence au stream.
+std::ostream& operator<<(std::ostream& outputStream, const ChaineInternee& chaine)
+{
+    return outputStream << chaine.get();
+}
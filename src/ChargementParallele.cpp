@@ -0,0 +1,47 @@
+/// Interprétation parallèle des lignes d'un fichier de données.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "ChargementParallele.h"
+#include <algorithm>
+
+namespace ChargementParallele
+{
+    /// Détermine le nombre de threads à utiliser.
+    /// \param nombreThreadsDemande Le nombre de threads demandé, ou 0 pour utiliser tous les coeurs disponibles.
+    /// \return                     Le nombre de threads effectif, au moins 1.
+    std::size_t getNombreThreads(std::size_t nombreThreadsDemande)
+    {
+        if (nombreThreadsDemande == 0)
+        {
+            nombreThreadsDemande = std::thread::hardware_concurrency();
+        }
+        return std::max<std::size_t>(nombreThreadsDemande, 1);
+    }
+
+    /// Découpe le contenu en blocs de tailles semblables dont chaque frontière suit immédiatement un '\n', de sorte
+    /// qu'aucune ligne ne soit partagée entre deux blocs.
+    /// \param contenu      Le contenu à découper.
+    /// \param nombreBlocs  Le nombre de blocs désiré. Moins de blocs peuvent être produits si le contenu est court.
+    /// \return             Les blocs non vides, dans l'ordre du contenu.
+    std::vector<std::string_view> decouperEnBlocs(std::string_view contenu, std::size_t nombreBlocs)
+    {
+        std::vector<std::string_view> blocs;
+        std::size_t tailleCible = contenu.size() / std::max<std::size_t>(nombreBlocs, 1) + 1;
+        while (!contenu.empty())
+        {
+            std::size_t finBloc = contenu.size();
+            if (tailleCible < contenu.size())
+            {
+                std::size_t finLigne = contenu.find('\n', tailleCible - 1);
+                if (finLigne != std::string_view::npos)
+                {
+                    finBloc = finLigne + 1;
+                }
+            }
+            blocs.push_back(contenu.substr(0, finBloc));
+            contenu.remove_prefix(finBloc);
+        }
+        return blocs;
+    }
+} // namespace ChargementParallele
@@ -0,0 +1,99 @@
+/// Classement des films par nombre de vues, maintenu à chaque vue.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "ClassementPopularite.h"
+#include <utility>
+
+/// Ajoute une vue à un élément et le remonte dans le classement, en O(1) amorti.
+/// \param indice   L'indice de l'élément.
+void ClassementPopularite::ajouterVue(std::uint32_t indice)
+{
+    if (indice >= vues_.size())
+    {
+        vues_.resize(indice + std::size_t{1});
+        positions_.resize(indice + std::size_t{1});
+    }
+    if (debutsGroupes_.empty())
+    {
+        debutsGroupes_.push_back(0);
+    }
+
+    // Un élément sans vue entre à la fin du classement, dans le groupe des éléments à zéro vue
+    auto nombreVues = static_cast<std::size_t>(vues_[indice]);
+    if (nombreVues == 0)
+    {
+        positions_[indice] = ordre_.size();
+        ordre_.push_back(indice);
+    }
+
+    // Le groupe des éléments ayant une vue de plus se termine juste avant le groupe actuel: échanger l'élément avec
+    // le premier de son groupe puis avancer le début du groupe le fait passer dans le groupe suivant.
+    if (nombreVues + 1 == debutsGroupes_.size())
+    {
+        debutsGroupes_.push_back(0);
+    }
+    std::size_t position = positions_[indice];
+    std::size_t debutGroupe = debutsGroupes_[nombreVues];
+    std::uint32_t premierDuGroupe = ordre_[debutGroupe];
+    std::swap(ordre_[position], ordre_[debutGroupe]);
+    positions_[premierDuGroupe] = position;
+    positions_[indice] = debutGroupe;
+    debutsGroupes_[nombreVues]++;
+    vues_[indice]++;
+}
+
+/// Retire une vue à un élément et le descend dans le classement, en O(1). Un élément qui n'a plus de vue est retiré
+/// du classement.
+/// \param indice   L'indice de l'élément, qui doit avoir au moins une vue.
+void ClassementPopularite::retirerVue(std::uint32_t indice)
+{
+    // Le groupe des éléments ayant une vue de moins commence juste après le groupe actuel: échanger l'élément avec le
+    // dernier de son groupe puis reculer le début du groupe suivant le fait passer dans ce groupe.
+    auto nombreVues = static_cast<std::size_t>(vues_[indice]);
+    std::size_t position = positions_[indice];
+    std::size_t finGroupe = debutsGroupes_[nombreVues - 1] - 1;
+    std::uint32_t dernierDuGroupe = ordre_[finGroupe];
+    std::swap(ordre_[position], ordre_[finGroupe]);
+    positions_[dernierDuGroupe] = position;
+    positions_[indice] = finGroupe;
+    debutsGroupes_[nombreVues - 1]--;
+    vues_[indice]--;
+
+    // Un élément sans vue est nécessairement le dernier du classement, seul dans le groupe des éléments à zéro vue
+    if (vues_[indice] == 0)
+    {
+        ordre_.pop_back();
+    }
+}
+
+/// Retire tous les éléments du classement.
+void ClassementPopularite::effacer()
+{
+    vues_.clear();
+    ordre_.clear();
+    positions_.clear();
+    debutsGroupes_.clear();
+}
+
+/// Retourne le nombre de vues d'un élément.
+/// \param indice   L'indice de l'élément.
+/// \return         Le nombre de vues, 0 si l'élément n'a jamais été vu.
+int ClassementPopularite::getNombreVues(std::uint32_t indice) const
+{
+    return indice < vues_.size() ? vues_[indice] : 0;
+}
+
+/// Retourne le nombre de vues de chaque élément.
+/// \return Le nombre de vues par indice.
+const std::vector<int>& ClassementPopularite::getVues() const
+{
+    return vues_;
+}
+
+/// Retourne les indices des éléments ayant au moins une vue, en ordre décroissant de vues.
+/// \return Les indices classés.
+const std::vector<std::uint32_t>& ClassementPopularite::getOrdre() const
+{
+    return ordre_;
+}
@@ -0,0 +1,176 @@
+/// Stockage en colonnes des entrées du log.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "ColonnesLogs.h"
+#include <algorithm>
+#include <iterator>
+
+/// Constructeur à partir du début de chacune des trois colonnes de la tranche.
+/// \param timestamps       Le premier horodatage de la tranche.
+/// \param utilisateurs     Le premier indice d'utilisateur de la tranche.
+/// \param films            Le premier indice de film de la tranche.
+/// \param nombreEntrees    Le nombre d'entrées de la tranche.
+TrancheLogs::TrancheLogs(const std::int64_t* timestamps, const std::uint32_t* utilisateurs,
+                         const std::uint32_t* films, std::size_t nombreEntrees)
+    : timestamps_(timestamps)
+    , utilisateurs_(utilisateurs)
+    , films_(films)
+    , nombreEntrees_(nombreEntrees)
+{
+}
+
+/// Retourne le nombre d'entrées de la tranche.
+/// \return Le nombre d'entrées.
+std::size_t TrancheLogs::getNombreEntrees() const
+{
+    return nombreEntrees_;
+}
+
+/// Indique si la tranche ne contient aucune entrée.
+/// \return True si la tranche est vide.
+bool TrancheLogs::estVide() const
+{
+    return nombreEntrees_ == 0;
+}
+
+/// Retourne le début de la colonne des horodatages de la tranche.
+/// \return Pointeur vers getNombreEntrees() horodatages triés.
+const std::int64_t* TrancheLogs::getTimestamps() const
+{
+    return timestamps_;
+}
+
+/// Retourne le début de la colonne des indices d'utilisateurs de la tranche.
+/// \return Pointeur vers getNombreEntrees() indices d'utilisateurs.
+const std::uint32_t* TrancheLogs::getUtilisateurs() const
+{
+    return utilisateurs_;
+}
+
+/// Retourne le début de la colonne des indices de films de la tranche.
+/// \return Pointeur vers getNombreEntrees() indices de films.
+const std::uint32_t* TrancheLogs::getFilms() const
+{
+    return films_;
+}
+
+/// Retourne le nombre d'entrées conservées.
+/// \return Le nombre d'entrées.
+std::size_t ColonnesLogs::getNombreEntrees() const
+{
+    return timestamps_.size();
+}
+
+/// Indique si aucune entrée n'est conservée.
+/// \return True si les colonnes sont vides.
+bool ColonnesLogs::estVide() const
+{
+    return timestamps_.empty();
+}
+
+/// Reconstitue une entrée à partir de ses trois colonnes.
+/// \param index    La position de l'entrée (doit être inférieure à getNombreEntrees()).
+/// \return         L'entrée.
+EntreeLog ColonnesLogs::getEntree(std::size_t index) const
+{
+    return EntreeLog{timestamps_[index], utilisateurs_[index], films_[index]};
+}
+
+/// Retourne la colonne des horodatages, triée en ordre croissant.
+/// \return Les horodatages en secondes depuis l'époque Unix.
+const std::vector<std::int64_t>& ColonnesLogs::getTimestamps() const
+{
+    return timestamps_;
+}
+
+/// Retourne la colonne des indices d'utilisateurs.
+/// \return Les indices d'utilisateurs, dans le même ordre que les horodatages.
+const std::vector<std::uint32_t>& ColonnesLogs::getUtilisateurs() const
+{
+    return utilisateurs_;
+}
+
+/// Retourne la colonne des indices de films.
+/// \return Les indices de films, dans le même ordre que les horodatages.
+const std::vector<std::uint32_t>& ColonnesLogs::getFilms() const
+{
+    return films_;
+}
+
+/// Retourne une vue sur toutes les entrées.
+/// \return La tranche couvrant tout le log.
+TrancheLogs ColonnesLogs::getTranche() const
+{
+    return TrancheLogs(timestamps_.data(), utilisateurs_.data(), films_.data(), timestamps_.size());
+}
+
+/// Retourne une vue sur les entrées dont l'horodatage est dans l'intervalle [debut, fin). Les bornes sont trouvées
+/// par recherche binaire, en O(log n).
+/// \param debut    La borne inférieure incluse, en secondes depuis l'époque Unix.
+/// \param fin      La borne supérieure exclue, en secondes depuis l'époque Unix.
+/// \return         La tranche correspondante, vide si fin <= debut.
+TrancheLogs ColonnesLogs::getTranche(std::int64_t debut, std::int64_t fin) const
+{
+    auto itDebut = std::lower_bound(timestamps_.begin(), timestamps_.end(), debut);
+    auto itFin = fin > debut ? std::lower_bound(itDebut, timestamps_.end(), fin) : itDebut;
+    auto position = static_cast<std::size_t>(std::distance(timestamps_.begin(), itDebut));
+    return TrancheLogs(timestamps_.data() + position, utilisateurs_.data() + position, films_.data() + position,
+                       static_cast<std::size_t>(std::distance(itDebut, itFin)));
+}
+
+/// Insère une entrée après toutes les entrées de même horodatage ou d'horodatage inférieur.
+/// \param entreeLog    L'entrée à insérer.
+void ColonnesLogs::inserer(const EntreeLog& entreeLog)
+{
+    auto it = std::upper_bound(timestamps_.begin(), timestamps_.end(), entreeLog.timestamp);
+    auto position = std::distance(timestamps_.begin(), it);
+    timestamps_.insert(it, entreeLog.timestamp);
+    utilisateurs_.insert(std::next(utilisateurs_.begin(), position), entreeLog.utilisateur);
+    films_.insert(std::next(films_.begin(), position), entreeLog.film);
+}
+
+/// Fusionne un lot d'entrées déjà triées avec les entrées existantes. À horodatage égal, les entrées existantes
+/// restent devant celles du lot. La fusion se fait en place à partir de la fin des colonnes, en O(n + m).
+/// \param entreesTriees    Les entrées à ajouter, triées de façon stable par horodatage.
+void ColonnesLogs::fusionner(const std::vector<EntreeLog>& entreesTriees)
+{
+    std::size_t nombreExistants = timestamps_.size();
+    std::size_t nombreTotal = nombreExistants + entreesTriees.size();
+    timestamps_.resize(nombreTotal);
+    utilisateurs_.resize(nombreTotal);
+    films_.resize(nombreTotal);
+
+    // Les entrées du lot plus récentes que toutes les entrées existantes sont simplement copiées à la fin, ce qui
+    // couvre sans déplacement le cas courant d'un log déjà chronologique.
+    std::size_t restantsExistants = nombreExistants;
+    std::size_t restantsLot = entreesTriees.size();
+    std::size_t destination = nombreTotal;
+    while (restantsLot > 0)
+    {
+        const EntreeLog& entreeLot = entreesTriees[restantsLot - 1];
+        destination--;
+        if (restantsExistants > 0 && timestamps_[restantsExistants - 1] > entreeLot.timestamp)
+        {
+            restantsExistants--;
+            timestamps_[destination] = timestamps_[restantsExistants];
+            utilisateurs_[destination] = utilisateurs_[restantsExistants];
+            films_[destination] = films_[restantsExistants];
+        }
+        else
+        {
+            restantsLot--;
+            timestamps_[destination] = entreeLot.timestamp;
+            utilisateurs_[destination] = entreeLot.utilisateur;
+            films_[destination] = entreeLot.film;
+        }
+    }
+}
+
+/// Retire toutes les entrées.
+void ColonnesLogs::effacer()
+{
+    timestamps_.clear();
+    utilisateurs_.clear();
+    films_.clear();
+}
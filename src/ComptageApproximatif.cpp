@@ -0,0 +1,295 @@
+/// Comptage approximatif des vues en mémoire bornée.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "ComptageApproximatif.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/// Constructeur à partir des garanties voulues.
+/// \param erreurRelative   L'erreur ε permise, en fraction du nombre total d'ajouts (entre 0 et 1 exclusivement).
+/// \param probabiliteEchec La probabilité δ qu'une estimation dépasse cette erreur (entre 0 et 1 exclusivement).
+EsquisseCountMin::EsquisseCountMin(double erreurRelative, double probabiliteEchec)
+    : largeur_(4)
+    , decalage_(62)
+{
+    // Une largeur en puissance de 2 permet un hachage par multiplication et décalage
+    auto largeurMinimale = static_cast<std::size_t>(std::ceil(std::exp(1.0) / erreurRelative));
+    while (largeur_ < largeurMinimale)
+    {
+        largeur_ *= 2;
+        decalage_--;
+    }
+    auto profondeur = static_cast<std::size_t>(std::max(1.0, std::ceil(std::log(1.0 / probabiliteEchec))));
+
+    // Graine fixe: les estimations sont reproductibles d'une exécution à l'autre
+    std::mt19937_64 generateur(0x9E3779B97F4A7C15);
+    for (std::size_t i = 0; i < profondeur; i++)
+    {
+        multiplicateurs_.push_back(generateur() | 1);
+        additifs_.push_back(generateur());
+    }
+    compteurs_.resize(largeur_ * profondeur);
+}
+
+/// Ajoute une occurrence d'une clé, en O(profondeur).
+/// \param cle  La clé.
+void EsquisseCountMin::ajouter(std::uint32_t cle)
+{
+    int minimum = std::numeric_limits<int>::max();
+    for (std::size_t ligne = 0; ligne < getProfondeur(); ligne++)
+    {
+        minimum = std::min(minimum, compteurs_[getPosition(ligne, cle)]);
+    }
+    for (std::size_t ligne = 0; ligne < getProfondeur(); ligne++)
+    {
+        int& compteur = compteurs_[getPosition(ligne, cle)];
+        if (compteur == minimum)
+        {
+            compteur++;
+        }
+    }
+    nombreAjouts_++;
+}
+
+/// Estime le nombre d'occurrences d'une clé, en O(profondeur).
+/// \param cle  La clé.
+/// \return     Une estimation qui ne sous-estime jamais le compte réel.
+int EsquisseCountMin::estimer(std::uint32_t cle) const
+{
+    int minimum = std::numeric_limits<int>::max();
+    for (std::size_t ligne = 0; ligne < getProfondeur(); ligne++)
+    {
+        minimum = std::min(minimum, compteurs_[getPosition(ligne, cle)]);
+    }
+    return minimum;
+}
+
+/// Remet tous les compteurs à zéro en conservant les dimensions et les fonctions de hachage.
+void EsquisseCountMin::effacer()
+{
+    std::fill(compteurs_.begin(), compteurs_.end(), 0);
+    nombreAjouts_ = 0;
+}
+
+/// Retourne le nombre de compteurs par ligne.
+/// \return La largeur de l'esquisse.
+std::size_t EsquisseCountMin::getLargeur() const
+{
+    return largeur_;
+}
+
+/// Retourne le nombre de lignes, soit le nombre de fonctions de hachage.
+/// \return La profondeur de l'esquisse.
+std::size_t EsquisseCountMin::getProfondeur() const
+{
+    return multiplicateurs_.size();
+}
+
+/// Retourne le nombre total d'ajouts N, qui borne l'erreur à εN.
+/// \return Le nombre d'ajouts depuis la création ou le dernier effacement.
+std::int64_t EsquisseCountMin::getNombreAjouts() const
+{
+    return nombreAjouts_;
+}
+
+/// Calcule la position du compteur d'une clé dans une ligne par hachage multiplicatif (multiply-add-shift).
+/// \param ligne    La ligne.
+/// \param cle      La clé.
+/// \return         La position du compteur dans compteurs_.
+std::size_t EsquisseCountMin::getPosition(std::size_t ligne, std::uint32_t cle) const
+{
+    auto colonne = static_cast<std::size_t>((multiplicateurs_[ligne] * cle + additifs_[ligne]) >> decalage_);
+    return ligne * largeur_ + colonne;
+}
+
+/// Constructeur à partir du nombre de clés suivies.
+/// \param capacite Le nombre maximal de clés suivies k, strictement positif.
+ResumeSpaceSaving::ResumeSpaceSaving(std::size_t capacite)
+    : capacite_(capacite)
+{
+    tas_.reserve(capacite);
+    positions_.reserve(capacite);
+}
+
+/// Ajoute une occurrence d'une clé, en O(log k).
+/// \param cle  La clé.
+void ResumeSpaceSaving::ajouter(std::uint32_t cle)
+{
+    auto it = positions_.find(cle);
+    if (it != positions_.end())
+    {
+        tas_[it->second].compte++;
+        descendre(it->second);
+    }
+    else if (tas_.size() < capacite_)
+    {
+        tas_.push_back({cle, 1, 0});
+        positions_.emplace(cle, tas_.size() - 1);
+        remonter(tas_.size() - 1);
+    }
+    else
+    {
+        // La clé de plus petit compte est remplacée et lui cède son compte comme erreur
+        positions_.erase(tas_.front().cle);
+        int minimum = tas_.front().compte;
+        tas_.front() = {cle, minimum + 1, minimum};
+        positions_.emplace(cle, 0);
+        descendre(0);
+    }
+}
+
+/// Trouve une clé suivie.
+/// \param cle  La clé.
+/// \return     L'élément suivi, ou nullptr si la clé n'est pas suivie (son compte réel est alors au plus N/k).
+const ResumeSpaceSaving::Element* ResumeSpaceSaving::trouver(std::uint32_t cle) const
+{
+    auto it = positions_.find(cle);
+    return it != positions_.end() ? &tas_[it->second] : nullptr;
+}
+
+/// Retourne les clés suivies de plus grand compte, en O(k log nombre).
+/// \param nombre   Le nombre maximal de clés à retourner.
+/// \return         Les éléments en ordre décroissant de compte.
+std::vector<ResumeSpaceSaving::Element> ResumeSpaceSaving::getPlusFrequents(std::size_t nombre) const
+{
+    std::vector<Element> elements = tas_;
+    auto fin = std::next(elements.begin(), static_cast<std::ptrdiff_t>(std::min(nombre, elements.size())));
+    std::partial_sort(elements.begin(), fin, elements.end(),
+                      [](const Element& element1, const Element& element2)
+                      { return element1.compte > element2.compte; });
+    elements.erase(fin, elements.end());
+    return elements;
+}
+
+/// Retire toutes les clés suivies.
+void ResumeSpaceSaving::effacer()
+{
+    tas_.clear();
+    positions_.clear();
+}
+
+/// Retourne le nombre maximal de clés suivies.
+/// \return La capacité k du résumé.
+std::size_t ResumeSpaceSaving::getCapacite() const
+{
+    return capacite_;
+}
+
+/// Descend un élément dont le compte a augmenté jusqu'à rétablir l'ordre du tas.
+/// \param position La position de l'élément dans le tas.
+void ResumeSpaceSaving::descendre(std::size_t position)
+{
+    while (true)
+    {
+        std::size_t plusPetit = position;
+        for (std::size_t enfant = 2 * position + 1; enfant <= 2 * position + 2 && enfant < tas_.size(); enfant++)
+        {
+            if (tas_[enfant].compte < tas_[plusPetit].compte)
+            {
+                plusPetit = enfant;
+            }
+        }
+        if (plusPetit == position)
+        {
+            return;
+        }
+        echanger(position, plusPetit);
+        position = plusPetit;
+    }
+}
+
+/// Remonte un nouvel élément jusqu'à rétablir l'ordre du tas.
+/// \param position La position de l'élément dans le tas.
+void ResumeSpaceSaving::remonter(std::size_t position)
+{
+    while (position > 0 && tas_[position].compte < tas_[(position - 1) / 2].compte)
+    {
+        echanger(position, (position - 1) / 2);
+        position = (position - 1) / 2;
+    }
+}
+
+/// Échange deux éléments du tas en mettant leurs positions à jour.
+/// \param position1    La position d'un des éléments.
+/// \param position2    La position de l'autre élément.
+void ResumeSpaceSaving::echanger(std::size_t position1, std::size_t position2)
+{
+    std::swap(tas_[position1], tas_[position2]);
+    positions_[tas_[position1].cle] = position1;
+    positions_[tas_[position2].cle] = position2;
+}
+
+/// Constructeur à partir des garanties voulues.
+/// \param erreurRelative       L'erreur ε de l'esquisse, en fraction du nombre total de vues.
+/// \param probabiliteEchec     La probabilité δ qu'une estimation de l'esquisse dépasse cette erreur.
+/// \param nombreFilmsSuivis    Le nombre de films suivis par le résumé Space-Saving.
+CompteurVuesApproximatif::CompteurVuesApproximatif(double erreurRelative, double probabiliteEchec,
+                                                   std::size_t nombreFilmsSuivis)
+    : esquisse_(erreurRelative, probabiliteEchec)
+    , resume_(nombreFilmsSuivis)
+{
+}
+
+/// Ajoute une vue à un film.
+/// \param indice   L'indice du film.
+void CompteurVuesApproximatif::ajouterVue(std::uint32_t indice)
+{
+    esquisse_.ajouter(indice);
+    resume_.ajouter(indice);
+}
+
+/// Estime le nombre de vues d'un film.
+/// \param indice   L'indice du film.
+/// \return         Une estimation v̂ telle que v ≤ v̂ ≤ v + εN avec une probabilité d'au moins 1 - δ, bornée aussi par
+///                 v + N/k si le film est suivi.
+int CompteurVuesApproximatif::estimerVues(std::uint32_t indice) const
+{
+    int estimation = esquisse_.estimer(indice);
+    if (const ResumeSpaceSaving::Element* element = resume_.trouver(indice))
+    {
+        estimation = std::min(estimation, element->compte);
+    }
+    return estimation;
+}
+
+/// Estime les films les plus vus parmi les films suivis, qui incluent tous les films ayant plus de N/k vues.
+/// \param nombre   Le nombre maximal de films à retourner.
+/// \return         Les indices des films en ordre décroissant de vues estimées, avec leur estimation.
+std::vector<std::pair<std::uint32_t, int>> CompteurVuesApproximatif::getPlusVus(std::size_t nombre) const
+{
+    std::vector<std::pair<std::uint32_t, int>> plusVus;
+    for (const ResumeSpaceSaving::Element& element : resume_.getPlusFrequents(resume_.getCapacite()))
+    {
+        plusVus.emplace_back(element.cle, std::min(element.compte, esquisse_.estimer(element.cle)));
+    }
+    auto fin = std::next(plusVus.begin(), static_cast<std::ptrdiff_t>(std::min(nombre, plusVus.size())));
+    std::partial_sort(plusVus.begin(), fin, plusVus.end(),
+                      [](const std::pair<std::uint32_t, int>& paire1, const std::pair<std::uint32_t, int>& paire2)
+                      { return paire1.second > paire2.second; });
+    plusVus.erase(fin, plusVus.end());
+    return plusVus;
+}
+
+/// Efface tous les comptes en conservant les paramètres.
+void CompteurVuesApproximatif::effacer()
+{
+    esquisse_.effacer();
+    resume_.effacer();
+}
+
+/// Retourne l'esquisse Count-Min.
+/// \return L'esquisse.
+const EsquisseCountMin& CompteurVuesApproximatif::getEsquisse() const
+{
+    return esquisse_;
+}
+
+/// Retourne le résumé Space-Saving.
+/// \return Le résumé.
+const ResumeSpaceSaving& CompteurVuesApproximatif::getResume() const
+{
+    return resume_;
+}
@@ -0,0 +1,139 @@
+/// Fichier projeté en mémoire en lecture seule.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "FichierMappe.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// Constructeur qui ouvre le fichier et le projette en mémoire en entier.
+/// \param nomFichier   Le fichier à projeter. Utiliser estOuvert() pour savoir si l'opération a réussi.
+FichierMappe::FichierMappe(const std::string& nomFichier)
+{
+#ifdef _WIN32
+    HANDLE fichier = CreateFileA(nomFichier.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                 OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fichier == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    fichier_ = fichier;
+
+    LARGE_INTEGER taille;
+    if (!GetFileSizeEx(fichier, &taille))
+    {
+        fermer();
+        return;
+    }
+    taille_ = static_cast<std::size_t>(taille.QuadPart);
+    if (taille_ == 0) // Impossible de projeter un fichier vide
+    {
+        estOuvert_ = true;
+        return;
+    }
+
+    projection_ = CreateFileMappingA(fichier, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (projection_ == nullptr)
+    {
+        fermer();
+        return;
+    }
+    donnees_ = static_cast<const char*>(MapViewOfFile(projection_, FILE_MAP_READ, 0, 0, 0));
+    if (donnees_ == nullptr)
+    {
+        fermer();
+        return;
+    }
+    estOuvert_ = true;
+#else
+    int descripteur = open(nomFichier.c_str(), O_RDONLY);
+    if (descripteur == -1)
+    {
+        return;
+    }
+
+    struct stat informations;
+    if (fstat(descripteur, &informations) == -1)
+    {
+        close(descripteur);
+        return;
+    }
+    taille_ = static_cast<std::size_t>(informations.st_size);
+    if (taille_ == 0) // Impossible de projeter un fichier vide
+    {
+        close(descripteur);
+        estOuvert_ = true;
+        return;
+    }
+
+    void* adresse = mmap(nullptr, taille_, PROT_READ, MAP_PRIVATE, descripteur, 0);
+    close(descripteur); // La projection reste valide après la fermeture du descripteur
+    if (adresse == MAP_FAILED)
+    {
+        taille_ = 0;
+        return;
+    }
+    madvise(adresse, taille_, MADV_SEQUENTIAL);
+    donnees_ = static_cast<const char*>(adresse);
+    estOuvert_ = true;
+#endif
+}
+
+/// Destructeur qui libère la projection du fichier.
+FichierMappe::~FichierMappe()
+{
+    fermer();
+}
+
+/// Indique si le fichier a pu être ouvert et projeté en mémoire.
+/// \return True si le contenu est disponible, false sinon.
+bool FichierMappe::estOuvert() const
+{
+    return estOuvert_;
+}
+
+/// Retourne une vue sur le contenu complet du fichier, valide tant que l'objet existe.
+/// \return La vue sur les octets projetés (vide si le fichier est vide ou n'a pas pu être ouvert).
+std::string_view FichierMappe::getContenu() const
+{
+    if (donnees_ == nullptr)
+    {
+        return std::string_view();
+    }
+    return std::string_view(donnees_, taille_);
+}
+
+/// Libère la projection et les ressources système associées.
+void FichierMappe::fermer()
+{
+#ifdef _WIN32
+    if (donnees_ != nullptr)
+    {
+        UnmapViewOfFile(donnees_);
+    }
+    if (projection_ != nullptr)
+    {
+        CloseHandle(projection_);
+    }
+    if (fichier_ != nullptr)
+    {
+        CloseHandle(fichier_);
+    }
+    projection_ = nullptr;
+    fichier_ = nullptr;
+#else
+    if (donnees_ != nullptr)
+    {
+        munmap(const_cast<char*>(donnees_), taille_);
+    }
+#endif
+    donnees_ = nullptr;
+    taille_ = 0;
+    estOuvert_ = false;
+}
@@ -5,6 +5,14 @@
 #include "Film.h"
 #include <unordered_map>
 
+/// Indique si un genre, par exemple lu d'un fichier, correspond à une valeur du enum.
+/// \param genre    Le genre à vérifier.
+/// \return         True si le genre peut servir d'indice dans un tableau de Film::nombreGenres éléments.
+bool estGenreValide(Film::Genre genre)
+{
+    return static_cast<std::size_t>(genre) < Film::nombreGenres;
+}
+
 /// Convertit la valeur du enum Film::Genre en string.
 /// \param genre    Le genre à convertir.
 /// \return         String représentant le enum.
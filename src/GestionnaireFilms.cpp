@@ -8,24 +8,97 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
 #include <sstream>
-#include "Foncteurs.h"
-#include "RawPointerBackInserter.h"
+#include "ChargementParallele.h"
+#include "FichierMappe.h"
+#include "Tokeniseur.h"
 
+namespace
+{
+    /// Foncteur qui interprète une ligne du fichier de films sans passer par un std::istringstream.
+    class InterpreteurLigneFilm
+    {
+    public:
+        /// Interprète une ligne et ajoute le film obtenu.
+        /// \param ligne    La ligne à interpréter.
+        /// \param films    Le vecteur auquel ajouter le film.
+        /// \return         False si la ligne n'a pas pu être interprétée.
+        bool operator()(std::string_view ligne, std::vector<Film>& films)
+        {
+            std::string_view nom;
+            int genre;
+            int pays;
+            std::string_view realisateur;
+            int annee;
+            if (!Tokeniseur::lireGuillemets(ligne, nom, tamponNom_) || !Tokeniseur::lireEntier(ligne, genre) ||
+                !Tokeniseur::lireEntier(ligne, pays) ||
+                !Tokeniseur::lireGuillemets(ligne, realisateur, tamponRealisateur_) ||
+                !Tokeniseur::lireEntier(ligne, annee) || !estGenreValide(static_cast<Film::Genre>(genre)) ||
+                !estPaysValide(static_cast<Pays>(pays)))
+            {
+                return false;
+            }
+            films.push_back(Film{std::string(nom), static_cast<Film::Genre>(genre), static_cast<Pays>(pays),
+                                 ChaineInternee(realisateur), annee});
+            return true;
+        }
 
-/// Constructeur par copie.
+    private:
+        std::string tamponNom_;
+        std::string tamponRealisateur_;
+    };
+} // namespace
+
+/// Constructeur par copie. Les films sont copiés dans des blocs alloués d'avance puis les filtres sont traduits vers
+/// les copies grâce à l'indice des films, sans être reconstruits, ce qui conserve leur ordre.
 /// \param other    Le gestionnaire de films à partir duquel copier la classe.
 GestionnaireFilms::GestionnaireFilms(const GestionnaireFilms& other)
+    : filtreRealisateurFilms_(other.filtreRealisateurFilms_)
+    , filtreAnneeFilms_(other.filtreAnneeFilms_)
+    , positionsFilms_(other.positionsFilms_)
+    , indexTitres_(other.indexTitres_)
+    , bitsFilms_(other.bitsFilms_)
+    , bitsGenres_(other.bitsGenres_)
+    , bitsPays_(other.bitsPays_)
+    , bitsAnnees_(other.bitsAnnees_)
+    , prochainIndice_(other.prochainIndice_)
+    , indicesLibres_(other.indicesLibres_)
 {
-    films_.reserve(other.films_.size());
-    filtreNomFilms_.reserve(other.filtreNomFilms_.size());
-    filtreGenreFilms_.reserve(other.filtreGenreFilms_.size());
-    filtrePaysFilms_.reserve(other.filtrePaysFilms_.size());
+    std::vector<const Film*> copiesParIndice(other.positionsFilms_.size());
+    films_.reserver(other.films_.getNombreElements());
+    filtreNomFilms_.reserver(other.filtreNomFilms_.getTaille());
+    other.films_.pourChaque(
+        [&](const Film& film)
+        {
+            const Film* copie = films_.creer(film);
+            copiesParIndice[film.indice] = copie;
+            filtreNomFilms_.inserer(copie->nom, copie);
+        });
 
-    for (const auto& film : other.films_)
+    auto traduire = [&copiesParIndice](const Film* film) { return copiesParIndice[film->indice]; };
+    for (std::size_t i = 0; i < filtreGenreFilms_.size(); i++)
+    {
+        std::transform(other.filtreGenreFilms_[i].begin(), other.filtreGenreFilms_[i].end(),
+                       std::back_inserter(filtreGenreFilms_[i]), traduire);
+    }
+    for (std::size_t i = 0; i < filtrePaysFilms_.size(); i++)
+    {
+        std::transform(other.filtrePaysFilms_[i].begin(), other.filtrePaysFilms_[i].end(),
+                       std::back_inserter(filtrePaysFilms_[i]), traduire);
+    }
+    for (auto& filmsRealisateur : filtreRealisateurFilms_)
+    {
+        std::transform(filmsRealisateur.begin(), filmsRealisateur.end(), filmsRealisateur.begin(), traduire);
+    }
+    for (auto& [annee, filmsAnnee] : filtreAnneeFilms_)
     {
-        ajouterFilm(*film);
+        std::transform(filmsAnnee.begin(), filmsAnnee.end(), filmsAnnee.begin(), traduire);
     }
+    indexTitres_.remplacerFilms(copiesParIndice);
+    filmsParIndice_ = std::move(copiesParIndice);
 }
 
 /// Opérateur d'assignation par copie utilisant le copy-and-swap idiom.
@@ -37,6 +110,17 @@ GestionnaireFilms& GestionnaireFilms::operator=(GestionnaireFilms other)
     std::swap(filtreNomFilms_, other.filtreNomFilms_);
     std::swap(filtreGenreFilms_, other.filtreGenreFilms_);
     std::swap(filtrePaysFilms_, other.filtrePaysFilms_);
+    std::swap(filtreRealisateurFilms_, other.filtreRealisateurFilms_);
+    std::swap(filtreAnneeFilms_, other.filtreAnneeFilms_);
+    std::swap(positionsFilms_, other.positionsFilms_);
+    std::swap(indexTitres_, other.indexTitres_);
+    std::swap(filmsParIndice_, other.filmsParIndice_);
+    std::swap(bitsFilms_, other.bitsFilms_);
+    std::swap(bitsGenres_, other.bitsGenres_);
+    std::swap(bitsPays_, other.bitsPays_);
+    std::swap(bitsAnnees_, other.bitsAnnees_);
+    std::swap(prochainIndice_, other.prochainIndice_);
+    std::swap(indicesLibres_, other.indicesLibres_);
     return *this;
 }
 
@@ -49,14 +133,18 @@ std::ostream& operator<<(std::ostream& outputStream, const GestionnaireFilms& ge
     outputStream << "Le gestionnaire de films contient "  << gestionnaireFilms.getNombreFilms() << " films.\n"
                  << "Affichage par catégories:\n";
 
-    for (auto& [key, liste] : gestionnaireFilms.filtreGenreFilms_)
+    for (std::size_t i = 0; i < Film::nombreGenres; i++)
     {
-        Film::Genre genre = key;
-        std::vector<const Film*> listeFilms = liste;
+        auto genre = static_cast<Film::Genre>(i);
+        VueFilms listeFilms = gestionnaireFilms.getFilmsParGenre(genre);
+        if (listeFilms.empty())
+        {
+            continue;
+        }
         outputStream << "Genre: " << getGenreString(genre) << " (" << listeFilms.size() << " films):\n";
-        for (std::size_t i = 0; i < listeFilms.size(); i++)
+        for (std::size_t j = 0; j < listeFilms.size(); j++)
         {
-            outputStream << '\t' << *listeFilms[i] << '\n';
+            outputStream << '\t' << *listeFilms[j] << '\n';
         }
     }
     return outputStream;
@@ -70,10 +158,7 @@ bool GestionnaireFilms::chargerDepuisFichier(const std::string& nomFichier)
     std::ifstream fichier(nomFichier);
     if (fichier)
     {
-        films_.clear();
-        filtreNomFilms_.clear();
-        filtreGenreFilms_.clear();
-        filtrePaysFilms_.clear();
+        effacer();
 
         bool succesParsing = true;
 
@@ -88,9 +173,11 @@ bool GestionnaireFilms::chargerDepuisFichier(const std::string& nomFichier)
             std::string realisateur;
             int annee;
 
-            if (stream >> std::quoted(nom) >> genre >> pays >> std::quoted(realisateur) >> annee)
+            if (stream >> std::quoted(nom) >> genre >> pays >> std::quoted(realisateur) >> annee &&
+                estGenreValide(static_cast<Film::Genre>(genre)) && estPaysValide(static_cast<Pays>(pays)))
             {
-                ajouterFilm(Film{nom, static_cast<Film::Genre>(genre), static_cast<Pays>(pays), realisateur, annee});
+                ajouterFilm(Film{nom, static_cast<Film::Genre>(genre), static_cast<Pays>(pays),
+                                 ChaineInternee(realisateur), annee});
             }
             else
             {
@@ -105,43 +192,179 @@ bool GestionnaireFilms::chargerDepuisFichier(const std::string& nomFichier)
     return false;
 }
 
-/// Ajoute le film passé en paramètre au vecteur de films du gestionnaire de film.
+/// Ajoute les films à partir d'un fichier de description des films en interprétant le fichier projeté en mémoire par
+/// blocs sur plusieurs threads. Les films sont ensuite ajoutés dans l'ordre du fichier, donc le contenu final et les
+/// erreurs rapportées sont identiques à ceux de chargerDepuisFichier.
+/// \param nomFichier       Le fichier à partir duquel lire les informations des films.
+/// \param nombreThreads    Le nombre de threads à utiliser (0 pour le nombre de coeurs disponibles).
+/// \return                 True si tout le chargement s'est effectué avec succès, false sinon.
+bool GestionnaireFilms::chargerDepuisFichierParallele(const std::string& nomFichier, std::size_t nombreThreads)
+{
+    FichierMappe fichier(nomFichier);
+    if (fichier.estOuvert())
+    {
+        effacer();
+
+        auto resultats = ChargementParallele::interpreterLignes<Film>(fichier.getContenu(), nombreThreads,
+                                                                      InterpreteurLigneFilm());
+
+        bool succesParsing = true;
+        std::size_t nombreFilms = 0;
+        for (const auto& resultat : resultats)
+        {
+            nombreFilms += resultat.elements.size();
+        }
+        films_.reserver(nombreFilms);
+        filtreNomFilms_.reserver(nombreFilms);
+
+        for (const auto& resultat : resultats)
+        {
+            for (const Film& film : resultat.elements)
+            {
+                ajouterFilm(film);
+            }
+            for (std::string_view ligne : resultat.lignesInvalides)
+            {
+                std::cerr << "Erreur GestionnaireFilms: la ligne " << ligne
+                          << " n'a pas pu être interprétée correctement\n";
+                succesParsing = false;
+            }
+        }
+        return succesParsing;
+    }
+    std::cerr << "Erreur GestionnaireFilms: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
+    return false;
+}
+
+/// Ajoute le film passé en paramètre au vecteur de films du gestionnaire de film. Le film reçoit le prochain indice
+/// libre du gestionnaire, peu importe la valeur de son champ indice: celui d'un film supprimé s'il y en a un, pour que
+/// les tables par indice ne grandissent pas avec chaque ajout.
 /// \param film    Film qui doit être ajouté aux vecteurs s'il existe.
-/// \return        Un bool qui représente si l'ajout du film à bien été effectué.
+/// \return        Un bool qui représente si l'ajout du film à bien été effectué. L'ajout échoue si un film du même
+///                nom existe déjà ou si le genre ou le pays du film ne correspond à aucune valeur de son enum.
 bool GestionnaireFilms::ajouterFilm(const Film& film)
 {
-    if (getFilmParNom(film.nom) == nullptr)
+    if (estGenreValide(film.genre) && estPaysValide(film.pays) && getFilmParNom(film.nom) == nullptr)
     {
-        films_.push_back(std::make_unique<Film>(film));
-        const Film* ptr = films_.back().get();
-        filtreNomFilms_.emplace(film.nom, ptr);
-        filtreGenreFilms_[film.genre].push_back(ptr);
-        filtrePaysFilms_[film.pays].push_back(ptr);
+        Film filmIndexe = film;
+        if (indicesLibres_.empty())
+        {
+            filmIndexe.indice = prochainIndice_++;
+        }
+        else
+        {
+            filmIndexe.indice = indicesLibres_.back();
+            indicesLibres_.pop_back();
+        }
+        indexerFilm(filmIndexe);
         return true;
     }
     return false;
 }
 
-/// Supprime un film du gestionnaire a partir de son nom.
-/// \param nomFilm    Le nom du film a supprimer.
-/// \return           Un bool representant si l'operation a ete faite avec succes.
-bool GestionnaireFilms::supprimerFilm(const std::string& nomFilm)
+/// Ajoute un film en conservant son indice et l'insère dans les filtres en notant ses positions.
+/// \param film    Le film à ajouter, dont le nom et l'indice ne sont pas déjà présents.
+/// \return        Le film ajouté, dont l'adresse reste valide jusqu'à sa suppression.
+const Film* GestionnaireFilms::indexerFilm(const Film& film)
 {
-    auto it = std::find_if(films_.begin(), films_.end(), 
-        [nomFilm](std::unique_ptr<Film>& film) { return film->nom == nomFilm; });
-    if (it != films_.end())
+    const Film* ptr = films_.creer(film);
+    std::vector<const Film*>& filmsGenre = filtreGenreFilms_[static_cast<std::size_t>(film.genre)];
+    std::vector<const Film*>& filmsPays = filtrePaysFilms_[static_cast<std::size_t>(film.pays)];
+    if (film.realisateur.getIdentifiant() >= filtreRealisateurFilms_.size())
     {
-        filtreNomFilms_.erase((*it)->nom);
+        filtreRealisateurFilms_.resize(film.realisateur.getIdentifiant() + std::size_t{1});
+    }
+    std::vector<const Film*>& filmsRealisateur = filtreRealisateurFilms_[film.realisateur.getIdentifiant()];
+    std::vector<const Film*>& filmsAnnee = filtreAnneeFilms_[film.annee];
+    if (film.indice >= positionsFilms_.size())
+    {
+        positionsFilms_.resize(film.indice + std::size_t{1});
+        filmsParIndice_.resize(film.indice + std::size_t{1});
+    }
+    positionsFilms_[film.indice] = {filmsGenre.size(), filmsPays.size(), filmsRealisateur.size(), filmsAnnee.size()};
+    filmsParIndice_[film.indice] = ptr;
+    bitsFilms_.ajouter(film.indice);
+    bitsGenres_[static_cast<std::size_t>(film.genre)].ajouter(film.indice);
+    bitsPays_[static_cast<std::size_t>(film.pays)].ajouter(film.indice);
+    bitsAnnees_[film.annee].ajouter(film.indice);
+
+    filtreNomFilms_.inserer(ptr->nom, ptr);
+    indexTitres_.ajouter(ptr);
+    filmsGenre.push_back(ptr);
+    filmsPays.push_back(ptr);
+    filmsRealisateur.push_back(ptr);
+    filmsAnnee.push_back(ptr);
+    return ptr;
+}
 
-        std::vector<const Film*>& filmsGenre = filtreGenreFilms_[(*it)->genre];
-        auto removeGenre = std::remove(filmsGenre.begin(), filmsGenre.end(), it->get());
-        filmsGenre.erase(removeGenre);
+/// Retire tous les films ainsi que les filtres et les tables qui en découlent. Les filtres sont vidés avant les films
+/// puisque leurs clés et leurs pointeurs désignent les films.
+void GestionnaireFilms::effacer()
+{
+    filtreNomFilms_.effacer();
+    filtreGenreFilms_.fill({});
+    filtrePaysFilms_.fill({});
+    filtreRealisateurFilms_.clear();
+    filtreAnneeFilms_.clear();
+    positionsFilms_.clear();
+    indexTitres_.effacer();
+    filmsParIndice_.clear();
+    bitsFilms_ = EnsembleBits();
+    bitsGenres_.fill({});
+    bitsPays_.fill({});
+    bitsAnnees_.clear();
+    prochainIndice_ = 0;
+    indicesLibres_.clear();
+    films_.effacer();
+}
 
-        std::vector<const Film*>& filmsPays = filtrePaysFilms_[(*it)->pays];
-        auto removePays = std::remove(filmsPays.begin(), filmsPays.end(), it->get());
-        filmsPays.erase(removePays);
+/// Retire un film d'un filtre en temps constant en le remplaçant par le dernier film du filtre.
+/// \param filtre      Le vecteur du filtre qui contient le film.
+/// \param position    Le membre de PositionsFilm qui donne la position des films dans ce filtre.
+/// \param film        Le film à retirer.
+void GestionnaireFilms::retirerDuFiltre(std::vector<const Film*>& filtre, std::size_t PositionsFilm::*position,
+                                        const Film* film)
+{
+    std::size_t positionFilm = positionsFilms_[film->indice].*position;
+    const Film* dernierFilm = filtre.back();
+    filtre[positionFilm] = dernierFilm;
+    positionsFilms_[dernierFilm->indice].*position = positionFilm;
+    filtre.pop_back();
+}
 
-        films_.erase(it);
+/// Supprime un film du gestionnaire a partir de son nom, en temps constant (plus la recherche de son année dans le
+/// filtre par année): le film est trouvé par le filtre par nom, remplacé par le dernier élément de chacun de ses
+/// filtres puis détruit dans son emplacement, qui sera réutilisé. Les pointeurs vers les autres films restent
+/// valides, mais l'ordre des films dans les filtres n'est plus l'ordre d'ajout. L'indice du film est attribué au
+/// prochain film ajouté.
+/// \param nomFilm    Le nom du film a supprimer.
+/// \return           Un bool representant si l'operation a ete faite avec succes.
+bool GestionnaireFilms::supprimerFilm(std::string_view nomFilm)
+{
+    if (const Film* film = filtreNomFilms_.retirer(nomFilm))
+    {
+        retirerDuFiltre(filtreGenreFilms_[static_cast<std::size_t>(film->genre)], &PositionsFilm::genre, film);
+        retirerDuFiltre(filtrePaysFilms_[static_cast<std::size_t>(film->pays)], &PositionsFilm::pays, film);
+        retirerDuFiltre(filtreRealisateurFilms_[film->realisateur.getIdentifiant()], &PositionsFilm::realisateur,
+                        film);
+        auto filmsAnnee = filtreAnneeFilms_.find(film->annee);
+        retirerDuFiltre(filmsAnnee->second, &PositionsFilm::annee, film);
+        if (filmsAnnee->second.empty())
+        {
+            filtreAnneeFilms_.erase(filmsAnnee);
+            bitsAnnees_.erase(film->annee);
+        }
+        else
+        {
+            bitsAnnees_[film->annee].retirer(film->indice);
+        }
+        indexTitres_.retirer(film);
+        indicesLibres_.push_back(film->indice);
+        filmsParIndice_[film->indice] = nullptr;
+        bitsFilms_.retirer(film->indice);
+        bitsGenres_[static_cast<std::size_t>(film->genre)].retirer(film->indice);
+        bitsPays_[static_cast<std::size_t>(film->pays)].retirer(film->indice);
+        films_.detruire(film);
         return true;
     }
     return false;
@@ -151,55 +374,164 @@ bool GestionnaireFilms::supprimerFilm(const std::string& nomFilm)
 /// \return    Size_t qui represente le nombre de films qui sont actuellement dans le gestionnaire.
 std::size_t GestionnaireFilms::getNombreFilms() const
 {
-    return films_.size();
+    return films_.getNombreElements();
 }
 
 /// Trouve et retourne un pointeur constant vers un film à l'aide de son nom.
 /// \param nom    Le nom du film a chercher.
 /// \return       Un pointeur constant vers le film ayant ce nom ou un nullptr si celui-ci n'existe pas.
-const Film* GestionnaireFilms::getFilmParNom(const std::string& nom) const
+const Film* GestionnaireFilms::getFilmParNom(std::string_view nom) const
 {
-    auto it = filtreNomFilms_.find(nom);
-    if (it != filtreNomFilms_.end())
-    {
-        return it->second;
-    }
-    return nullptr;
+    return filtreNomFilms_.trouver(nom);
 }
-/// Trouve et retourne le vecteur contenant tout les films ayant le genre passé en paramètre.
+/// Trouve et retourne tout les films ayant le genre passé en paramètre, en O(1) et sans copie.
 /// \param genre    clé permettant l'accès au vecteurs de films associé au genre.
-/// \return         Une copie du vecteur de pointeurs constant de Film ayant ce genre.
-std::vector<const Film*> GestionnaireFilms::getFilmsParGenre(Film::Genre genre) const
+/// \return         Une vue sur les films ayant ce genre, en ordre d'ajout s'il n'y a eu aucune suppression. La vue
+///                 est invalidée par toute modification du gestionnaire (ajout, suppression, chargement,
+///                 assignation) ou par sa destruction. Elle est vide si le genre est invalide.
+VueFilms GestionnaireFilms::getFilmsParGenre(Film::Genre genre) const
 {
-    auto it = filtreGenreFilms_.find(genre);
-    if (it != filtreGenreFilms_.end())
+    if (!estGenreValide(genre))
     {
-        return it->second;
+        return VueFilms();
     }
-    return std::vector<const Film*>();
+    return filtreGenreFilms_[static_cast<std::size_t>(genre)];
 }
 
-/// Retourne une copie de la liste des films associés a un pays donné.
+/// Retourne la liste des films associés a un pays donné, en O(1) et sans copie.
 /// \param pays    Le pays donné que nous voulons associé à une liste de films.
-/// \return        Vector qui contient la liste de films associes au pays donne.
-std::vector<const Film*> GestionnaireFilms::getFilmsParPays(Pays pays) const
+/// \return        Une vue sur les films associés au pays donné, en ordre d'ajout s'il n'y a eu aucune suppression.
+///                La vue est invalidée par toute modification du gestionnaire (ajout, suppression, chargement,
+///                assignation) ou par sa destruction. Elle est vide si le pays est invalide.
+VueFilms GestionnaireFilms::getFilmsParPays(Pays pays) const
+{
+    if (!estPaysValide(pays))
+    {
+        return VueFilms();
+    }
+    return filtrePaysFilms_[static_cast<std::size_t>(pays)];
+}
+
+/// Trouve et retourne tous les films d'un réalisateur, en O(1) et sans copie.
+/// \param realisateur  Le nom du réalisateur.
+/// \return             Une vue sur les films de ce réalisateur, vide s'il n'en a aucun, en ordre d'ajout s'il n'y a
+///                     eu aucune suppression. La vue est invalidée par toute modification du gestionnaire ou par sa
+///                     destruction.
+VueFilms GestionnaireFilms::getFilmsParRealisateur(std::string_view realisateur) const
 {
-    auto it = filtrePaysFilms_.find(pays);
-    if (it != filtrePaysFilms_.end())
+    // Un réalisateur inconnu n'est pas interné: la recherche ne fait pas grossir le réservoir
+    std::optional<ChaineInternee> realisateurInterne = ChaineInternee::trouver(realisateur);
+    if (!realisateurInterne || realisateurInterne->getIdentifiant() >= filtreRealisateurFilms_.size())
     {
-        return (it->second);
+        return VueFilms();
     }
-    return std::vector<const Film*>();
+    return filtreRealisateurFilms_[realisateurInterne->getIdentifiant()];
 }
 
-/// Trouve et retourne un vecteur des films qui ont été réalisés entre les années passées en paramètres.
+/// Trouve et retourne un vecteur des films qui ont été réalisés entre les années passées en paramètres, en
+/// O(log n + k) grâce au filtre par année.
 /// \param anneDebut    Borne inférieure de l'intervalle de recherche.
 /// \param anneeFin     Borne supérieure de l'intervalle de recherche.
-/// \return             Le vecteur contenant tout les films ayant une date de création compris dans l'intervalle.
-std::vector<const Film*> GestionnaireFilms::getFilmsEntreAnnees(int anneeDebut, int anneeFin)
+/// \return             Le vecteur contenant tout les films ayant une date de création compris dans l'intervalle, en
+///                     ordre croissant d'année.
+std::vector<const Film*> GestionnaireFilms::getFilmsEntreAnnees(int anneeDebut, int anneeFin) const
 {
     std::vector<const Film*> filmsTrouves;
-    std::copy_if(films_.begin(), films_.end(), RawPointerBackInserter(filmsTrouves), 
-        EstDansIntervalleDatesFilm(anneeDebut, anneeFin));
+    if (anneeDebut > anneeFin)
+    {
+        return filmsTrouves;
+    }
+    auto fin = filtreAnneeFilms_.upper_bound(anneeFin);
+    for (auto it = filtreAnneeFilms_.lower_bound(anneeDebut); it != fin; ++it)
+    {
+        filmsTrouves.insert(filmsTrouves.end(), it->second.begin(), it->second.end());
+    }
     return filmsTrouves;
+}
+
+/// Trouve les films qui satisfont tous les critères d'une requête. Chaque critère est évalué par l'union des ensembles
+/// de bits de ses valeurs, puis les critères sont combinés par intersection, 64 films à la fois; seuls les films
+/// retenus sont ensuite lus.
+/// \param requete  Les critères de la recherche.
+/// \return         Les films retenus, en ordre croissant d'indice, soit en ordre d'ajout au catalogue s'il n'y a eu
+///                 aucune suppression.
+std::vector<const Film*> GestionnaireFilms::rechercherFilms(const RequeteFilms& requete) const
+{
+    EnsembleBits filmsRetenus = bitsFilms_;
+    if (!requete.genres.empty())
+    {
+        EnsembleBits filmsGenres;
+        for (Film::Genre genre : requete.genres)
+        {
+            if (!estGenreValide(genre))
+            {
+                continue;
+            }
+            filmsGenres.unir(bitsGenres_[static_cast<std::size_t>(genre)]);
+        }
+        filmsRetenus.intersecter(filmsGenres);
+    }
+    if (!requete.pays.empty())
+    {
+        EnsembleBits filmsPays;
+        for (Pays pays : requete.pays)
+        {
+            if (!estPaysValide(pays))
+            {
+                continue;
+            }
+            filmsPays.unir(bitsPays_[static_cast<std::size_t>(pays)]);
+        }
+        filmsRetenus.intersecter(filmsPays);
+    }
+    if (requete.anneeDebut > std::numeric_limits<int>::min() || requete.anneeFin < std::numeric_limits<int>::max())
+    {
+        EnsembleBits filmsAnnees;
+        if (requete.anneeDebut <= requete.anneeFin)
+        {
+            auto fin = bitsAnnees_.upper_bound(requete.anneeFin);
+            for (auto it = bitsAnnees_.lower_bound(requete.anneeDebut); it != fin; ++it)
+            {
+                filmsAnnees.unir(it->second);
+            }
+        }
+        filmsRetenus.intersecter(filmsAnnees);
+    }
+    if (requete.realisateur)
+    {
+        // Un ensemble par réalisateur coûterait trop de mémoire: celui-ci est construit à partir du filtre, en O(k)
+        EnsembleBits filmsRealisateur;
+        for (const Film* film : getFilmsParRealisateur(*requete.realisateur))
+        {
+            filmsRealisateur.ajouter(film->indice);
+        }
+        filmsRetenus.intersecter(filmsRealisateur);
+    }
+
+    std::vector<const Film*> filmsTrouves;
+    filmsTrouves.reserve(filmsRetenus.compter());
+    filmsRetenus.pourChaque([this, &filmsTrouves](std::size_t indice)
+                            { filmsTrouves.push_back(filmsParIndice_[indice]); });
+    return filmsTrouves;
+}
+
+/// Cherche les films dont le nom commence par un préfixe, sans parcourir tous les films.
+/// \param prefixe  Le préfixe, sans distinction entre majuscules et minuscules ASCII.
+/// \param limite   Le nombre maximal de films à retourner.
+/// \return         Les films trouvés, en ordre alphabétique de leur nom.
+std::vector<const Film*> GestionnaireFilms::rechercherFilmsParPrefixe(std::string_view prefixe,
+                                                                      std::size_t limite) const
+{
+    return indexTitres_.rechercherPrefixe(prefixe, limite);
+}
+
+/// Cherche les films dont le nom contient une sous-chaîne, sans parcourir tous les films si elle a au moins trois
+/// caractères.
+/// \param sousChaine   La sous-chaîne, sans distinction entre majuscules et minuscules ASCII.
+/// \param limite       Le nombre maximal de films à retourner.
+/// \return             Les films trouvés, en ordre d'ajout au gestionnaire.
+std::vector<const Film*> GestionnaireFilms::rechercherFilmsParSousChaine(std::string_view sousChaine,
+                                                                         std::size_t limite) const
+{
+    return indexTitres_.rechercherSousChaine(sousChaine, limite);
 }
\ No newline at end of file
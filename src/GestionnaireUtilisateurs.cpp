@@ -4,10 +4,90 @@
 /// modifié 2020-03-11
 
 #include "GestionnaireUtilisateurs.h"
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include "ChargementParallele.h"
+#include "FichierMappe.h"
+#include "Tokeniseur.h"
+
+namespace
+{
+    /// Foncteur qui interprète une ligne du fichier d'utilisateurs sans passer par un std::istringstream.
+    class InterpreteurLigneUtilisateur
+    {
+    public:
+        /// Interprète une ligne et ajoute l'utilisateur obtenu.
+        /// \param ligne        La ligne à interpréter.
+        /// \param utilisateurs Le vecteur auquel ajouter l'utilisateur.
+        /// \return             False si la ligne n'a pas pu être interprétée.
+        bool operator()(std::string_view ligne, std::vector<Utilisateur>& utilisateurs)
+        {
+            std::string_view id;
+            std::string_view nom;
+            int age;
+            int pays;
+            if (!Tokeniseur::lireMot(ligne, id) || !Tokeniseur::lireGuillemets(ligne, nom, tamponNom_) ||
+                !Tokeniseur::lireEntier(ligne, age) || !Tokeniseur::lireEntier(ligne, pays) ||
+                !estPaysValide(static_cast<Pays>(pays)))
+            {
+                return false;
+            }
+            utilisateurs.push_back(Utilisateur{std::string(id), std::string(nom), age, static_cast<Pays>(pays)});
+            return true;
+        }
+
+    private:
+        std::string tamponNom_;
+    };
+} // namespace
+
+/// Constructeur par copie. Les utilisateurs sont copiés dans des blocs alloués d'avance puis le filtre par pays et par
+/// âge est traduit vers les copies grâce à l'indice des utilisateurs, ce qui conserve son ordre.
+/// \param other    Le gestionnaire d'utilisateurs à partir duquel copier la classe.
+GestionnaireUtilisateurs::GestionnaireUtilisateurs(const GestionnaireUtilisateurs& other)
+    : filtrePaysAgeUtilisateurs_(other.filtrePaysAgeUtilisateurs_)
+    , positionsUtilisateurs_(other.positionsUtilisateurs_)
+    , prochainIndice_(other.prochainIndice_)
+    , indicesLibres_(other.indicesLibres_)
+{
+    std::vector<const Utilisateur*> copiesParIndice(other.positionsUtilisateurs_.size());
+    entrepotUtilisateurs_.reserver(other.utilisateurs_.getTaille());
+    utilisateurs_.reserver(other.utilisateurs_.getTaille());
+    other.entrepotUtilisateurs_.pourChaque(
+        [&](const Utilisateur& utilisateur)
+        {
+            Utilisateur* copie = entrepotUtilisateurs_.creer(utilisateur);
+            copiesParIndice[utilisateur.indice] = copie;
+            utilisateurs_.inserer(copie->id, copie);
+        });
+
+    for (auto& utilisateursPays : filtrePaysAgeUtilisateurs_)
+    {
+        for (auto& [age, utilisateursAge] : utilisateursPays)
+        {
+            std::transform(utilisateursAge.begin(), utilisateursAge.end(), utilisateursAge.begin(),
+                           [&copiesParIndice](const Utilisateur* utilisateur)
+                           { return copiesParIndice[utilisateur->indice]; });
+        }
+    }
+}
+
+/// Opérateur d'assignation par copie utilisant le copy-and-swap idiom.
+/// \param other    Le gestionnaire d'utilisateurs à partir duquel copier la classe.
+/// \return         Référence à l'objet actuel.
+GestionnaireUtilisateurs& GestionnaireUtilisateurs::operator=(GestionnaireUtilisateurs other)
+{
+    std::swap(entrepotUtilisateurs_, other.entrepotUtilisateurs_);
+    std::swap(utilisateurs_, other.utilisateurs_);
+    std::swap(filtrePaysAgeUtilisateurs_, other.filtrePaysAgeUtilisateurs_);
+    std::swap(positionsUtilisateurs_, other.positionsUtilisateurs_);
+    std::swap(prochainIndice_, other.prochainIndice_);
+    std::swap(indicesLibres_, other.indicesLibres_);
+    return *this;
+}
 
 /// Affiche les informations des utilisateurs gérés par le gestionnaire d'utilisateurs à la sortie du stream donné.
 /// \param outputStream         Le stream auquel écrire les informations des utilisateurs.
@@ -17,10 +97,8 @@ std::ostream& operator<<(std::ostream& outputStream, const GestionnaireUtilisate
 {
     outputStream << "Le gestionnaire d'utilisateurs contient "  << gestionnaireUtilisateurs.getNombreUtilisateurs()
                  << " utilisateurs:\n";
-    for (const auto& [key, utilisateur] : gestionnaireUtilisateurs.utilisateurs_)
-    {
-        outputStream << '\t' << utilisateur << '\n';
-    }
+    gestionnaireUtilisateurs.entrepotUtilisateurs_.pourChaque(
+        [&outputStream](const Utilisateur& utilisateur) { outputStream << '\t' << utilisateur << '\n'; });
     return outputStream;
 }
 
@@ -32,7 +110,7 @@ bool GestionnaireUtilisateurs::chargerDepuisFichier(const std::string& nomFichie
     std::ifstream fichier(nomFichier);
     if (fichier)
     {
-        utilisateurs_.clear();
+        effacer();
 
         bool succesParsing = true;
 
@@ -46,7 +124,7 @@ bool GestionnaireUtilisateurs::chargerDepuisFichier(const std::string& nomFichie
             int age;
             int pays;
 
-            if (stream >> id >> std::quoted(nom) >> age >> pays)
+            if (stream >> id >> std::quoted(nom) >> age >> pays && estPaysValide(static_cast<Pays>(pays)))
             {
                 ajouterUtilisateur(Utilisateur{id, nom, age, static_cast<Pays>(pays)});
             }
@@ -63,38 +141,222 @@ bool GestionnaireUtilisateurs::chargerDepuisFichier(const std::string& nomFichie
     return false;
 }
 
-/// Construit une pair et l'ajoute dans le gestionnaire d'utilisateurs.
+/// Ajoute les utilisateurs à partir d'un fichier de données d'utilisateurs en interprétant le fichier projeté en
+/// mémoire par blocs sur plusieurs threads. Les utilisateurs sont ensuite ajoutés dans l'ordre du fichier, donc le
+/// contenu final et les erreurs rapportées sont identiques à ceux de chargerDepuisFichier.
+/// \param nomFichier       Le fichier à partir duquel lire les informations des utilisateurs.
+/// \param nombreThreads    Le nombre de threads à utiliser (0 pour le nombre de coeurs disponibles).
+/// \return                 True si tout le chargement s'est effectué avec succès, false sinon.
+bool GestionnaireUtilisateurs::chargerDepuisFichierParallele(const std::string& nomFichier,
+                                                             std::size_t nombreThreads)
+{
+    FichierMappe fichier(nomFichier);
+    if (fichier.estOuvert())
+    {
+        effacer();
+
+        auto resultats = ChargementParallele::interpreterLignes<Utilisateur>(fichier.getContenu(), nombreThreads,
+                                                                             InterpreteurLigneUtilisateur());
+
+        bool succesParsing = true;
+        std::size_t nombreUtilisateurs = 0;
+        for (const auto& resultat : resultats)
+        {
+            nombreUtilisateurs += resultat.elements.size();
+        }
+        utilisateurs_.reserver(nombreUtilisateurs);
+        entrepotUtilisateurs_.reserver(nombreUtilisateurs);
+
+        for (const auto& resultat : resultats)
+        {
+            for (const Utilisateur& utilisateur : resultat.elements)
+            {
+                ajouterUtilisateur(utilisateur);
+            }
+            for (std::string_view ligne : resultat.lignesInvalides)
+            {
+                std::cerr << "Erreur GestionnaireUtilisateurs: la ligne " << ligne
+                          << " n'a pas pu être interprétée correctement\n";
+                succesParsing = false;
+            }
+        }
+        return succesParsing;
+    }
+    std::cerr << "Erreur GestionnaireUtilisateurs: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
+    return false;
+}
+
+/// Construit une pair et l'ajoute dans le gestionnaire d'utilisateurs. L'utilisateur reçoit le prochain indice libre
+/// du gestionnaire, peu importe la valeur de son champ indice: celui d'un utilisateur supprimé s'il y en a un, pour
+/// que les tables par indice ne grandissent pas avec chaque ajout.
 /// \param utilisateur  L'objet de type Utilisateur a ajouter au gestionnaire.
-/// \return             Un bool representant si l'ajout à été fait avec succès.
+/// \return             Un bool representant si l'ajout à été fait avec succès. L'ajout échoue si l'ID existe déjà
+///                     ou si le pays ne correspond à aucune valeur du enum.
 bool GestionnaireUtilisateurs::ajouterUtilisateur(const Utilisateur& utilisateur)
 {
-    return utilisateurs_.emplace(utilisateur.id, utilisateur).second;
+    if (!estPaysValide(utilisateur.pays) || utilisateurs_.trouver(utilisateur.id) != nullptr)
+    {
+        return false;
+    }
+    Utilisateur utilisateurIndexe = utilisateur;
+    if (indicesLibres_.empty())
+    {
+        utilisateurIndexe.indice = prochainIndice_++;
+    }
+    else
+    {
+        utilisateurIndexe.indice = indicesLibres_.back();
+        indicesLibres_.pop_back();
+    }
+    indexerUtilisateur(std::move(utilisateurIndexe));
+    return true;
+}
+
+/// Retire tous les utilisateurs ainsi que les index qui en découlent. Les index sont vidés avant les utilisateurs
+/// puisque leurs clés et leurs pointeurs désignent les utilisateurs.
+void GestionnaireUtilisateurs::effacer()
+{
+    utilisateurs_.effacer();
+    filtrePaysAgeUtilisateurs_.fill({});
+    positionsUtilisateurs_.clear();
+    prochainIndice_ = 0;
+    indicesLibres_.clear();
+    entrepotUtilisateurs_.effacer();
 }
 
-/// Supprime un utilisateur du gestionnaire en utilisant son ID.
+/// Ajoute un utilisateur en conservant son indice et l'insère dans le filtre par pays et par âge en notant sa position.
+/// \param utilisateur  L'utilisateur à ajouter, dont l'identifiant et l'indice ne sont pas déjà présents.
+/// \return             L'utilisateur ajouté, dont l'adresse reste valide jusqu'à sa suppression.
+const Utilisateur* GestionnaireUtilisateurs::indexerUtilisateur(Utilisateur utilisateur)
+{
+    Utilisateur* ptr = entrepotUtilisateurs_.creer(std::move(utilisateur));
+    utilisateurs_.inserer(ptr->id, ptr);
+
+    std::vector<const Utilisateur*>& utilisateursAge =
+        filtrePaysAgeUtilisateurs_[static_cast<std::size_t>(ptr->pays)][ptr->age];
+    if (ptr->indice >= positionsUtilisateurs_.size())
+    {
+        positionsUtilisateurs_.resize(ptr->indice + std::size_t{1});
+    }
+    positionsUtilisateurs_[ptr->indice] = utilisateursAge.size();
+    utilisateursAge.push_back(ptr);
+    return ptr;
+}
+
+/// Supprime un utilisateur du gestionnaire en utilisant son ID. L'utilisateur est remplacé dans le filtre par pays et
+/// par âge par le dernier utilisateur de même pays et de même âge. Son indice est attribué au prochain utilisateur
+/// ajouté.
 /// \param idUtilisateur    Id de l'utilisateur qui sert comme clé pour retrouver l'utilisateur.
 /// \return                 Un bool représentant le nombre d'éléments supprimés soit 1 ou 0.
-bool GestionnaireUtilisateurs::supprimerUtilisateur(const std::string& idUtilisateur)
+bool GestionnaireUtilisateurs::supprimerUtilisateur(std::string_view idUtilisateur)
 {
-    return utilisateurs_.erase(idUtilisateur);
+    if (Utilisateur* utilisateur = utilisateurs_.retirer(idUtilisateur))
+    {
+        auto& utilisateursPays = filtrePaysAgeUtilisateurs_[static_cast<std::size_t>(utilisateur->pays)];
+        auto utilisateursAge = utilisateursPays.find(utilisateur->age);
+        std::size_t position = positionsUtilisateurs_[utilisateur->indice];
+        const Utilisateur* dernierUtilisateur = utilisateursAge->second.back();
+        utilisateursAge->second[position] = dernierUtilisateur;
+        positionsUtilisateurs_[dernierUtilisateur->indice] = position;
+        utilisateursAge->second.pop_back();
+        if (utilisateursAge->second.empty())
+        {
+            utilisateursPays.erase(utilisateursAge);
+        }
+        indicesLibres_.push_back(utilisateur->indice);
+        entrepotUtilisateurs_.detruire(utilisateur);
+        return true;
+    }
+    return false;
 }
 
 /// "Getter" du nombre d'utilisateurs dans le gestionnaire.
 /// \return     Un size_t representant le nombre d'utilisateurs dans le gestionnaire.
 std::size_t GestionnaireUtilisateurs::getNombreUtilisateurs() const
 {
-    return utilisateurs_.size();
+    return utilisateurs_.getTaille();
 }
 
 /// Trouve et retourne un utilisateur a l'aide de son ID.
 /// \param id   La clé unique d'un utilisateur nous permettant de le retrouver s'il existe.
 /// \return     Retourne un pointeur constant vers l'utilisateur ayant cet ID ou un nullptr s'il n'existe pas.
-const Utilisateur* GestionnaireUtilisateurs::getUtilisateurParId(const std::string& id) const
+const Utilisateur* GestionnaireUtilisateurs::getUtilisateurParId(std::string_view id) const
 {
-    auto it = utilisateurs_.find(id);
-    if (it != utilisateurs_.end())
+    return utilisateurs_.trouver(id);
+}
+
+/// Trouve les utilisateurs d'un pays dont l'âge est dans un intervalle, en O(log n + k) pour k utilisateurs trouvés.
+/// \param pays     Le pays des utilisateurs.
+/// \param ageMin   L'âge minimal, inclusif.
+/// \param ageMax   L'âge maximal, inclusif.
+/// \return         Les utilisateurs trouvés, en ordre croissant d'âge.
+std::vector<const Utilisateur*> GestionnaireUtilisateurs::getUtilisateursParPays(Pays pays, int ageMin,
+                                                                                 int ageMax) const
+{
+    std::vector<const Utilisateur*> utilisateursTrouves;
+    if (!estPaysValide(pays) || ageMin > ageMax)
+    {
+        return utilisateursTrouves;
+    }
+    const auto& utilisateursPays = filtrePaysAgeUtilisateurs_[static_cast<std::size_t>(pays)];
+    auto fin = utilisateursPays.upper_bound(ageMax);
+    for (auto it = utilisateursPays.lower_bound(ageMin); it != fin; ++it)
+    {
+        utilisateursTrouves.insert(utilisateursTrouves.end(), it->second.begin(), it->second.end());
+    }
+    return utilisateursTrouves;
+}
+
+/// Trouve les utilisateurs de tous les pays dont l'âge est dans un intervalle.
+/// \param ageMin   L'âge minimal, inclusif.
+/// \param ageMax   L'âge maximal, inclusif.
+/// \return         Les utilisateurs trouvés, par pays puis en ordre croissant d'âge.
+std::vector<const Utilisateur*> GestionnaireUtilisateurs::getUtilisateursEntreAges(int ageMin, int ageMax) const
+{
+    std::vector<const Utilisateur*> utilisateursTrouves;
+    for (std::size_t i = 0; i < nombrePays; i++)
+    {
+        std::vector<const Utilisateur*> utilisateursPays = getUtilisateursParPays(static_cast<Pays>(i), ageMin, ageMax);
+        utilisateursTrouves.insert(utilisateursTrouves.end(), utilisateursPays.begin(), utilisateursPays.end());
+    }
+    return utilisateursTrouves;
+}
+
+/// Compte les utilisateurs d'un pays dont l'âge est dans un intervalle sans les énumérer, à partir de l'histogramme
+/// des âges du pays.
+/// \param pays     Le pays des utilisateurs.
+/// \param ageMin   L'âge minimal, inclusif.
+/// \param ageMax   L'âge maximal, inclusif.
+/// \return         Le nombre d'utilisateurs.
+std::size_t GestionnaireUtilisateurs::getNombreUtilisateursParPays(Pays pays, int ageMin, int ageMax) const
+{
+    std::size_t nombreUtilisateurs = 0;
+    if (!estPaysValide(pays) || ageMin > ageMax)
+    {
+        return nombreUtilisateurs;
+    }
+    const auto& utilisateursPays = filtrePaysAgeUtilisateurs_[static_cast<std::size_t>(pays)];
+    auto fin = utilisateursPays.upper_bound(ageMax);
+    for (auto it = utilisateursPays.lower_bound(ageMin); it != fin; ++it)
+    {
+        nombreUtilisateurs += it->second.size();
+    }
+    return nombreUtilisateurs;
+}
+
+/// Retourne l'histogramme des âges des utilisateurs d'un pays.
+/// \param pays Le pays des utilisateurs.
+/// \return     Le nombre d'utilisateurs par âge, pour les âges ayant au moins un utilisateur.
+std::map<int, std::size_t> GestionnaireUtilisateurs::getHistogrammeAges(Pays pays) const
+{
+    std::map<int, std::size_t> histogramme;
+    if (!estPaysValide(pays))
+    {
+        return histogramme;
+    }
+    for (const auto& [age, utilisateursAge] : filtrePaysAgeUtilisateurs_[static_cast<std::size_t>(pays)])
     {
-        return &it->second;
+        histogramme.emplace_hint(histogramme.end(), age, utilisateursAge.size());
     }
-    return nullptr;
+    return histogramme;
 }
\ No newline at end of file
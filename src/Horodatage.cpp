@@ -0,0 +1,143 @@
+/// Conversion des horodatages des logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "Horodatage.h"
+
+namespace
+{
+    constexpr std::int64_t secondesParJour = 86400;
+
+    /// Calcule le nombre de jours écoulés depuis le 1970-01-01 pour une date du calendrier grégorien.
+    /// \param annee    L'année.
+    /// \param mois     Le mois (1 à 12).
+    /// \param jour     Le jour du mois (1 à 31).
+    /// \return         Le nombre de jours depuis l'époque Unix (négatif avant 1970).
+    std::int64_t getJoursDepuisEpoque(std::int64_t annee, std::int64_t mois, std::int64_t jour)
+    {
+        annee -= mois <= 2 ? 1 : 0;
+        std::int64_t ere = (annee >= 0 ? annee : annee - 399) / 400;
+        std::int64_t anneeDeEre = annee - ere * 400;
+        std::int64_t jourDeAnnee = (153 * (mois + (mois > 2 ? -3 : 9)) + 2) / 5 + jour - 1;
+        std::int64_t jourDeEre = anneeDeEre * 365 + anneeDeEre / 4 - anneeDeEre / 100 + jourDeAnnee;
+        return ere * 146097 + jourDeEre - 719468;
+    }
+
+    /// Retourne le nombre de jours d'un mois.
+    /// \param annee    L'année, pour les années bissextiles.
+    /// \param mois     Le mois (1 à 12).
+    /// \return         Le nombre de jours du mois.
+    std::int64_t getJoursDansMois(std::int64_t annee, std::int64_t mois)
+    {
+        static constexpr std::int64_t joursParMois[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        bool estBissextile = (annee % 4 == 0 && annee % 100 != 0) || annee % 400 == 0;
+        return mois == 2 && estBissextile ? 29 : joursParMois[mois - 1];
+    }
+
+    /// Lit un nombre composé d'exactement le nombre de chiffres donné.
+    /// \param texte            Le texte à partir duquel lire.
+    /// \param position         La position du premier chiffre.
+    /// \param nombreChiffres   Le nombre de chiffres à lire.
+    /// \param valeur           La valeur lue.
+    /// \return                 False si un des caractères n'est pas un chiffre.
+    bool lireChiffres(std::string_view texte, std::size_t position, std::size_t nombreChiffres, std::int64_t& valeur)
+    {
+        valeur = 0;
+        for (std::size_t i = position; i < position + nombreChiffres; i++)
+        {
+            if (texte[i] < '0' || texte[i] > '9')
+            {
+                return false;
+            }
+            valeur = valeur * 10 + (texte[i] - '0');
+        }
+        return true;
+    }
+
+    /// Écrit un nombre sur exactement le nombre de chiffres donné, complété par des zéros à gauche.
+    /// \param texte            La chaîne à laquelle ajouter les chiffres.
+    /// \param valeur           La valeur à écrire, positive.
+    /// \param nombreChiffres   Le nombre de chiffres à écrire.
+    void ecrireChiffres(std::string& texte, std::int64_t valeur, std::size_t nombreChiffres)
+    {
+        std::size_t fin = texte.size() + nombreChiffres;
+        texte.resize(fin);
+        for (std::size_t i = fin; i > fin - nombreChiffres; i--)
+        {
+            texte[i - 1] = static_cast<char>('0' + valeur % 10);
+            valeur /= 10;
+        }
+    }
+} // namespace
+
+/// Convertit un horodatage ISO 8601 en UTC de la forme "AAAA-MM-JJTHH:MM:SSZ" en secondes depuis l'époque Unix.
+/// \param texte    L'horodatage à convertir.
+/// \param secondes Le nombre de secondes depuis le 1970-01-01T00:00:00Z.
+/// \return         False si le texte n'est pas un horodatage valide de cette forme.
+bool convertirHorodatage(std::string_view texte, std::int64_t& secondes)
+{
+    static constexpr std::string_view gabarit = "0000-00-00T00:00:00Z";
+    if (texte.size() != gabarit.size() || texte[4] != '-' || texte[7] != '-' || texte[10] != 'T' ||
+        texte[13] != ':' || texte[16] != ':' || texte[19] != 'Z')
+    {
+        return false;
+    }
+
+    std::int64_t annee;
+    std::int64_t mois;
+    std::int64_t jour;
+    std::int64_t heure;
+    std::int64_t minute;
+    std::int64_t seconde;
+    if (!lireChiffres(texte, 0, 4, annee) || !lireChiffres(texte, 5, 2, mois) || !lireChiffres(texte, 8, 2, jour) ||
+        !lireChiffres(texte, 11, 2, heure) || !lireChiffres(texte, 14, 2, minute) ||
+        !lireChiffres(texte, 17, 2, seconde))
+    {
+        return false;
+    }
+    if (mois < 1 || mois > 12 || jour < 1 || jour > getJoursDansMois(annee, mois) || heure > 23 || minute > 59 ||
+        seconde > 59)
+    {
+        return false;
+    }
+
+    secondes = getJoursDepuisEpoque(annee, mois, jour) * secondesParJour + heure * 3600 + minute * 60 + seconde;
+    return true;
+}
+
+/// Convertit un nombre de secondes depuis l'époque Unix en horodatage ISO 8601 de la forme "AAAA-MM-JJTHH:MM:SSZ".
+/// Pour tout horodatage accepté par convertirHorodatage, le texte original est retrouvé exactement.
+/// \param secondes Le nombre de secondes depuis le 1970-01-01T00:00:00Z.
+/// \return         L'horodatage formaté.
+std::string formaterHorodatage(std::int64_t secondes)
+{
+    std::int64_t jours = (secondes >= 0 ? secondes : secondes - (secondesParJour - 1)) / secondesParJour;
+    std::int64_t secondesDuJour = secondes - jours * secondesParJour;
+
+    // Conversion inverse de getJoursDepuisEpoque
+    jours += 719468;
+    std::int64_t ere = (jours >= 0 ? jours : jours - 146096) / 146097;
+    std::int64_t jourDeEre = jours - ere * 146097;
+    std::int64_t anneeDeEre = (jourDeEre - jourDeEre / 1460 + jourDeEre / 36524 - jourDeEre / 146096) / 365;
+    std::int64_t jourDeAnnee = jourDeEre - (365 * anneeDeEre + anneeDeEre / 4 - anneeDeEre / 100);
+    std::int64_t moisDecale = (5 * jourDeAnnee + 2) / 153;
+    std::int64_t jour = jourDeAnnee - (153 * moisDecale + 2) / 5 + 1;
+    std::int64_t mois = moisDecale < 10 ? moisDecale + 3 : moisDecale - 9;
+    std::int64_t annee = anneeDeEre + ere * 400 + (mois <= 2 ? 1 : 0);
+
+    std::string texte;
+    texte.reserve(20);
+    ecrireChiffres(texte, annee, 4);
+    texte += '-';
+    ecrireChiffres(texte, mois, 2);
+    texte += '-';
+    ecrireChiffres(texte, jour, 2);
+    texte += 'T';
+    ecrireChiffres(texte, secondesDuJour / 3600, 2);
+    texte += ':';
+    ecrireChiffres(texte, secondesDuJour / 60 % 60, 2);
+    texte += ':';
+    ecrireChiffres(texte, secondesDuJour % 60, 2);
+    texte += 'Z';
+    return texte;
+}
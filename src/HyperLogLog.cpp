@@ -0,0 +1,110 @@
+/// Estimation du nombre d'éléments distincts en mémoire fixe.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "HyperLogLog.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+    /// Mélange une clé en 64 bits uniformément répartis (finaliseur de SplitMix64).
+    /// \param cle  La clé.
+    /// \return     Le hachage de la clé.
+    std::uint64_t hacher(std::uint32_t cle)
+    {
+        std::uint64_t hachage = cle + 0x9E3779B97F4A7C15;
+        hachage = (hachage ^ (hachage >> 30)) * 0xBF58476D1CE4E5B9;
+        hachage = (hachage ^ (hachage >> 27)) * 0x94D049BB133111EB;
+        return hachage ^ (hachage >> 31);
+    }
+} // namespace
+
+/// Constructeur à partir de la précision.
+/// \param precision    Le nombre p de bits qui choisissent le registre, ramené entre precisionMinimale et
+///                     precisionMaximale. L'esquisse occupe 2^p octets.
+HyperLogLog::HyperLogLog(std::uint8_t precision)
+    : precision_(std::clamp(precision, precisionMinimale, precisionMaximale))
+    , registres_(std::size_t{1} << precision_)
+{
+}
+
+/// Ajoute une clé, en O(1). Ajouter une clé déjà vue ne change pas l'estimation.
+/// \param cle  La clé.
+void HyperLogLog::ajouter(std::uint32_t cle)
+{
+    std::uint64_t hachage = hacher(cle);
+    auto registre = static_cast<std::size_t>(hachage >> (64 - precision_));
+    std::uint64_t reste = hachage << precision_;
+    std::uint8_t rang = 1;
+    while (rang <= 64 - precision_ && (reste & (std::uint64_t{1} << 63)) == 0)
+    {
+        reste <<= 1;
+        rang++;
+    }
+    registres_[registre] = std::max(registres_[registre], rang);
+}
+
+/// Fusionne une autre esquisse dans celle-ci.
+/// \param autre    L'esquisse à fusionner, qui doit avoir la même précision.
+/// \return         False si les précisions diffèrent, auquel cas l'esquisse n'est pas modifiée.
+bool HyperLogLog::fusionner(const HyperLogLog& autre)
+{
+    if (autre.precision_ != precision_)
+    {
+        std::cerr << "Erreur HyperLogLog: les esquisses à fusionner n'ont pas la même précision\n";
+        return false;
+    }
+    std::transform(registres_.begin(), registres_.end(), autre.registres_.begin(), registres_.begin(),
+                   [](std::uint8_t registre1, std::uint8_t registre2) { return std::max(registre1, registre2); });
+    return true;
+}
+
+/// Estime le nombre de clés distinctes ajoutées, en O(m). Les petites cardinalités sont estimées par comptage
+/// linéaire des registres vides, plus précis dans ce régime.
+/// \return L'estimation.
+double HyperLogLog::estimer() const
+{
+    auto m = static_cast<double>(registres_.size());
+    double alpha = 0.7213 / (1.0 + 1.079 / m);
+    if (registres_.size() == 16)
+    {
+        alpha = 0.673;
+    }
+    else if (registres_.size() == 32)
+    {
+        alpha = 0.697;
+    }
+    else if (registres_.size() == 64)
+    {
+        alpha = 0.709;
+    }
+
+    double somme = 0.0;
+    std::size_t registresVides = 0;
+    for (std::uint8_t registre : registres_)
+    {
+        somme += std::ldexp(1.0, -registre);
+        registresVides += registre == 0 ? 1 : 0;
+    }
+    double estimation = alpha * m * m / somme;
+    if (estimation <= 2.5 * m && registresVides > 0)
+    {
+        estimation = m * std::log(m / static_cast<double>(registresVides));
+    }
+    return estimation;
+}
+
+/// Remet tous les registres à zéro.
+void HyperLogLog::effacer()
+{
+    std::fill(registres_.begin(), registres_.end(), std::uint8_t{0});
+}
+
+/// Retourne la précision de l'esquisse.
+/// \return Le nombre p de bits qui choisissent le registre.
+std::uint8_t HyperLogLog::getPrecision() const
+{
+    return precision_;
+}
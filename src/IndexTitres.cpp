@@ -0,0 +1,268 @@
+/// Index de recherche sur les titres de films.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "IndexTitres.h"
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+    /// Bit qui distingue le code d'un bigramme de celui d'un trigramme, encodé dans les 24 bits de poids faible.
+    constexpr std::uint32_t marqueBigramme = std::uint32_t{1} << 24;
+
+    /// Convertit une lettre ASCII en minuscule, sans toucher aux autres octets.
+    /// \param caractere    Le caractère à convertir.
+    /// \return             Le caractère en minuscule.
+    char enMinuscule(char caractere)
+    {
+        return caractere >= 'A' && caractere <= 'Z' ? static_cast<char>(caractere - 'A' + 'a') : caractere;
+    }
+
+    /// Convertit les lettres ASCII d'une chaîne en minuscules, sans toucher aux autres octets.
+    /// \param chaine   La chaîne à convertir.
+    /// \return         La chaîne en minuscules.
+    std::string enMinuscules(std::string_view chaine)
+    {
+        std::string minuscules(chaine);
+        std::transform(minuscules.begin(), minuscules.end(), minuscules.begin(), enMinuscule);
+        return minuscules;
+    }
+
+    /// Indique si un titre contient une sous-chaîne sans distinction entre majuscules et minuscules ASCII, sans
+    /// convertir le titre au complet.
+    /// \param titre                    Le titre.
+    /// \param sousChaineMinuscules     La sous-chaîne, déjà en minuscules.
+    /// \return                         True si le titre contient la sous-chaîne.
+    bool contientSousChaine(std::string_view titre, std::string_view sousChaineMinuscules)
+    {
+        return std::search(titre.begin(), titre.end(), sousChaineMinuscules.begin(), sousChaineMinuscules.end(),
+                           [](char caractereTitre, char caractere)
+                           { return enMinuscule(caractereTitre) == caractere; }) != titre.end();
+    }
+
+    /// Encode les octets d'une suite de deux ou trois octets consécutifs d'une chaîne.
+    /// \param chaine   La chaîne.
+    /// \param debut    La position du premier octet.
+    /// \param taille   Le nombre d'octets, 2 ou 3.
+    /// \return         Le code de la suite; un bigramme porte la marqueBigramme.
+    std::uint32_t encoderNgramme(std::string_view chaine, std::size_t debut, std::size_t taille)
+    {
+        std::uint32_t code = taille == 2 ? marqueBigramme : 0;
+        for (std::size_t i = 0; i < taille; i++)
+        {
+            code |= std::uint32_t{static_cast<unsigned char>(chaine[debut + i])} << (8 * (taille - 1 - i));
+        }
+        return code;
+    }
+
+    /// Calcule les bigrammes et les trigrammes distincts d'une chaîne, soit toutes ses suites de deux et de trois
+    /// octets consécutifs.
+    /// \param chaine   La chaîne, déjà en minuscules.
+    /// \return         Les codes des bigrammes et des trigrammes, en ordre croissant.
+    std::vector<std::uint32_t> getNgrammes(std::string_view chaine)
+    {
+        std::vector<std::uint32_t> ngrammes;
+        for (std::size_t taille = 2; taille <= 3; taille++)
+        {
+            for (std::size_t i = 0; i + taille <= chaine.size(); i++)
+            {
+                ngrammes.push_back(encoderNgramme(chaine, i, taille));
+            }
+        }
+        std::sort(ngrammes.begin(), ngrammes.end());
+        ngrammes.erase(std::unique(ngrammes.begin(), ngrammes.end()), ngrammes.end());
+        return ngrammes;
+    }
+
+    /// Calcule les codes à chercher pour une sous-chaîne: son bigramme si elle a deux octets, ses trigrammes
+    /// distincts si elle en a plus.
+    /// \param sousChaine   La sous-chaîne d'au moins deux octets, déjà en minuscules.
+    /// \return             Les codes.
+    std::vector<std::uint32_t> getNgrammesRecherche(std::string_view sousChaine)
+    {
+        if (sousChaine.size() == 2)
+        {
+            return {encoderNgramme(sousChaine, 0, 2)};
+        }
+        std::vector<std::uint32_t> trigrammes;
+        for (std::size_t i = 0; i + 3 <= sousChaine.size(); i++)
+        {
+            trigrammes.push_back(encoderNgramme(sousChaine, i, 3));
+        }
+        std::sort(trigrammes.begin(), trigrammes.end());
+        trigrammes.erase(std::unique(trigrammes.begin(), trigrammes.end()), trigrammes.end());
+        return trigrammes;
+    }
+} // namespace
+
+/// Ajoute le titre d'un film à l'index sous un nouveau rang, ajouté à la fin de chaque liste de n-grammes en O(1)
+/// amorti, quel que soit l'indice du film.
+/// \param film Le film, dont l'adresse doit rester valide jusqu'à son retrait de l'index.
+void IndexTitres::ajouter(const Film* film)
+{
+    auto rang = static_cast<std::uint32_t>(films_.size());
+    films_.push_back(film);
+
+    std::string titre = enMinuscules(film->nom);
+    std::vector<std::uint32_t> ngrammes = getNgrammes(titre);
+    for (std::uint32_t ngramme : ngrammes)
+    {
+        ngrammes_[ngramme].push_back(rang);
+    }
+    nombreEntrees_ += ngrammes.size();
+    titres_.emplace(std::move(titre), rang);
+}
+
+/// Retire le titre d'un film de l'index. Ses entrées dans les listes de n-grammes deviennent périmées et sont
+/// ignorées par les recherches jusqu'au prochain compactage. Comme elles désignent son rang et non son indice,
+/// l'indice du film peut être réattribué aussitôt.
+/// \param film Le film, présent dans l'index.
+void IndexTitres::retirer(const Film* film)
+{
+    std::string titre = enMinuscules(film->nom);
+    auto [debut, fin] = titres_.equal_range(titre);
+    for (auto it = debut; it != fin; ++it)
+    {
+        if (films_[it->second] == film)
+        {
+            films_[it->second] = nullptr;
+            titres_.erase(it);
+            break;
+        }
+    }
+    nombreFilmsRetires_++;
+
+    nombreEntreesPerimees_ += getNgrammes(titre).size();
+    if (nombreEntreesPerimees_ * 2 > nombreEntrees_ || nombreFilmsRetires_ * 2 > films_.size())
+    {
+        compacter();
+    }
+}
+
+/// Retire tous les titres de l'index.
+void IndexTitres::effacer()
+{
+    films_.clear();
+    titres_.clear();
+    ngrammes_.clear();
+    nombreEntrees_ = 0;
+    nombreEntreesPerimees_ = 0;
+    nombreFilmsRetires_ = 0;
+}
+
+/// Remplace chaque film de l'index par celui de même indice, par exemple par sa copie après la copie de l'index.
+/// \param filmsParIndice   Les films par indice, qui doivent contenir un film pour l'indice de chaque film de l'index.
+void IndexTitres::remplacerFilms(const std::vector<const Film*>& filmsParIndice)
+{
+    for (const Film*& film : films_)
+    {
+        if (film != nullptr)
+        {
+            film = filmsParIndice[film->indice];
+        }
+    }
+}
+
+/// Cherche les films dont le titre commence par un préfixe, en O(log n + k) pour k films trouvés.
+/// \param prefixe  Le préfixe, sans distinction entre majuscules et minuscules ASCII.
+/// \param limite   Le nombre maximal de films à retourner.
+/// \return         Les films trouvés, en ordre alphabétique de leur titre en minuscules.
+std::vector<const Film*> IndexTitres::rechercherPrefixe(std::string_view prefixe, std::size_t limite) const
+{
+    std::string prefixeMinuscules = enMinuscules(prefixe);
+    std::vector<const Film*> filmsTrouves;
+    for (auto it = titres_.lower_bound(prefixeMinuscules);
+         it != titres_.end() && filmsTrouves.size() < limite &&
+         it->first.compare(0, prefixeMinuscules.size(), prefixeMinuscules) == 0;
+         ++it)
+    {
+        filmsTrouves.push_back(films_[it->second]);
+    }
+    return filmsTrouves;
+}
+
+/// Cherche les films dont le titre contient une sous-chaîne. Seuls les films de la plus courte liste parmi celles des
+/// trigrammes de la sous-chaîne, ou de son bigramme si elle n'a que deux octets, sont examinés: chacun doit apparaître
+/// dans les autres listes, puis son titre est vérifié. Une sous-chaîne d'un seul octet demande de parcourir les films
+/// jusqu'à la limite, ce qui reste rapide puisqu'une lettre apparaît dans la plupart des titres.
+/// \param sousChaine   La sous-chaîne, sans distinction entre majuscules et minuscules ASCII.
+/// \param limite       Le nombre maximal de films à retourner.
+/// \return             Les films trouvés, en ordre d'ajout à l'index.
+std::vector<const Film*> IndexTitres::rechercherSousChaine(std::string_view sousChaine, std::size_t limite) const
+{
+    std::string sousChaineMinuscules = enMinuscules(sousChaine);
+    std::vector<const Film*> filmsTrouves;
+
+    if (sousChaineMinuscules.size() < 2)
+    {
+        for (auto it = films_.begin(); it != films_.end() && filmsTrouves.size() < limite; ++it)
+        {
+            if (*it != nullptr && contientSousChaine((*it)->nom, sousChaineMinuscules))
+            {
+                filmsTrouves.push_back(*it);
+            }
+        }
+        return filmsTrouves;
+    }
+
+    std::vector<const std::vector<std::uint32_t>*> listes;
+    for (std::uint32_t ngramme : getNgrammesRecherche(sousChaineMinuscules))
+    {
+        auto it = ngrammes_.find(ngramme);
+        if (it == ngrammes_.end())
+        {
+            return filmsTrouves;
+        }
+        listes.push_back(&it->second);
+    }
+    std::sort(listes.begin(), listes.end(), [](const auto* liste1, const auto* liste2)
+              { return liste1->size() < liste2->size(); });
+
+    for (auto it = listes.front()->begin(); it != listes.front()->end() && filmsTrouves.size() < limite; ++it)
+    {
+        const Film* film = films_[*it];
+        if (film != nullptr &&
+            std::all_of(listes.begin() + 1, listes.end(), [rang = *it](const auto* liste)
+                        { return std::binary_search(liste->begin(), liste->end(), rang); }) &&
+            contientSousChaine(film->nom, sousChaineMinuscules))
+        {
+            filmsTrouves.push_back(film);
+        }
+    }
+    return filmsTrouves;
+}
+
+/// Retire des listes de n-grammes les rangs des films retirés, et les listes devenues vides, puis renumérote les rangs
+/// des films restants de façon contiguë. La renumérotation préserve l'ordre, donc les listes restent triées.
+void IndexTitres::compacter()
+{
+    constexpr std::uint32_t rangRetire = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> nouveauxRangs(films_.size(), rangRetire);
+    std::size_t nombreFilms = 0;
+    for (std::size_t rang = 0; rang < films_.size(); rang++)
+    {
+        if (films_[rang] != nullptr)
+        {
+            nouveauxRangs[rang] = static_cast<std::uint32_t>(nombreFilms);
+            films_[nombreFilms++] = films_[rang];
+        }
+    }
+    films_.resize(nombreFilms);
+
+    for (auto it = ngrammes_.begin(); it != ngrammes_.end();)
+    {
+        std::vector<std::uint32_t>& rangs = it->second;
+        std::transform(rangs.begin(), rangs.end(), rangs.begin(),
+                       [&nouveauxRangs](std::uint32_t rang) { return nouveauxRangs[rang]; });
+        rangs.erase(std::remove(rangs.begin(), rangs.end(), rangRetire), rangs.end());
+        it = rangs.empty() ? ngrammes_.erase(it) : std::next(it);
+    }
+    for (auto& [titre, rang] : titres_)
+    {
+        rang = nouveauxRangs[rang];
+    }
+    nombreEntrees_ -= nombreEntreesPerimees_;
+    nombreEntreesPerimees_ = 0;
+    nombreFilmsRetires_ = 0;
+}
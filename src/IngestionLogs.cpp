@@ -0,0 +1,135 @@
+/// Ingestion concurrente de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "IngestionLogs.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include "Horodatage.h"
+
+/// Constructeur qui démarre le thread de fusion.
+/// \param analyseurLogs    L'analyseur auquel ajouter les logs, qui doit exister plus longtemps que l'ingestion.
+/// \param nombreTampons    Le nombre de tampons des producteurs (0 pour le nombre de coeurs disponibles).
+/// \param intervalle       L'intervalle entre deux fusions.
+IngestionLogs::IngestionLogs(AnalyseurLogs& analyseurLogs, std::size_t nombreTampons,
+                             std::chrono::milliseconds intervalle)
+    : analyseurLogs_(&analyseurLogs)
+    , nombreTampons_(nombreTampons != 0 ? nombreTampons
+                                        : std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+    , intervalle_(intervalle)
+{
+    tampons_ = std::make_unique<Tampon[]>(nombreTampons_);
+    threadFusion_ = std::thread(&IngestionLogs::executerFusions, this);
+}
+
+/// Destructeur qui arrête le thread de fusion puis ajoute à l'analyseur les logs restés dans les tampons. Aucun
+/// producteur ne doit encore ajouter de logs.
+IngestionLogs::~IngestionLogs()
+{
+    {
+        std::lock_guard verrou(mutexArret_);
+        estArrete_ = true;
+    }
+    conditionArret_.notify_one();
+    threadFusion_.join();
+    fusionner();
+}
+
+/// Dépose une ligne de log en vue de son ajout à l'analyseur.
+/// \param ligneLog La ligne de log.
+/// \return         False si le timestamp n'est pas un horodatage valide, auquel cas la ligne est ignorée.
+bool IngestionLogs::ajouterLigneLog(const LigneLog& ligneLog)
+{
+    std::int64_t secondes;
+    if (!convertirHorodatage(ligneLog.timestamp, secondes))
+    {
+        return false;
+    }
+    ajouterLigneLog(secondes, ligneLog.utilisateur, ligneLog.film);
+    return true;
+}
+
+/// Dépose un log dont l'horodatage est déjà converti en vue de son ajout à l'analyseur.
+/// \param timestamp    L'horodatage du log en secondes depuis l'époque Unix.
+/// \param utilisateur  L'utilisateur du log.
+/// \param film         Le film du log.
+void IngestionLogs::ajouterLigneLog(std::int64_t timestamp, const Utilisateur* utilisateur, const Film* film)
+{
+    Tampon& tampon = getTamponThread();
+    std::lock_guard verrou(tampon.mutex);
+    tampon.logs.push_back({timestamp, utilisateur, film});
+    tampon.nombreLignesRecues++;
+}
+
+/// Ajoute immédiatement à l'analyseur tous les logs déposés avant l'appel, sans attendre la prochaine fusion.
+void IngestionLogs::vider()
+{
+    fusionner();
+}
+
+/// Retourne le nombre de logs déposés par les producteurs, fusionnés ou non.
+/// \return Le nombre de logs reçus.
+std::uint64_t IngestionLogs::getNombreLignesRecues() const
+{
+    std::uint64_t nombreLignes = 0;
+    for (std::size_t i = 0; i < nombreTampons_; i++)
+    {
+        std::lock_guard verrou(tampons_[i].mutex);
+        nombreLignes += tampons_[i].nombreLignesRecues;
+    }
+    return nombreLignes;
+}
+
+/// Retourne le nombre de logs déjà ajoutés à l'analyseur.
+/// \return Le nombre de logs ingérés.
+std::uint64_t IngestionLogs::getNombreLignesIngerees() const
+{
+    return nombreLignesIngerees_.load();
+}
+
+/// Retourne le tampon associé au thread appelant. Un même thread utilise toujours le même tampon.
+/// \return Le tampon.
+IngestionLogs::Tampon& IngestionLogs::getTamponThread()
+{
+    static thread_local const std::size_t hachageThread = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return tampons_[hachageThread % nombreTampons_];
+}
+
+/// Vide tous les tampons et ajoute leurs logs à l'analyseur en un seul lot. Chaque tampon n'est verrouillé que le
+/// temps d'échanger son vecteur avec un vecteur vide, donc les producteurs ne sont pas bloqués pendant l'ajout.
+void IngestionLogs::fusionner()
+{
+    std::lock_guard verrouAnalyseur(mutexAnalyseur_);
+    std::vector<EntreeLog> entreesLog;
+    for (std::size_t i = 0; i < nombreTampons_; i++)
+    {
+        {
+            std::lock_guard verrou(tampons_[i].mutex);
+            std::swap(logsEnFusion_, tampons_[i].logs); // Le tampon récupère la capacité du vecteur vide
+        }
+        for (const LogRecu& log : logsEnFusion_)
+        {
+            entreesLog.push_back(analyseurLogs_->creerEntreeLog(log.timestamp, log.utilisateur, log.film));
+        }
+        logsEnFusion_.clear();
+    }
+    if (!entreesLog.empty())
+    {
+        std::size_t nombreLignes = entreesLog.size();
+        analyseurLogs_->ajouterEntreesLog(std::move(entreesLog));
+        nombreLignesIngerees_ += nombreLignes;
+    }
+}
+
+/// Boucle du thread de fusion, qui fusionne les tampons à chaque intervalle jusqu'à l'arrêt de l'ingestion.
+void IngestionLogs::executerFusions()
+{
+    std::unique_lock verrou(mutexArret_);
+    while (!conditionArret_.wait_for(verrou, intervalle_, [this]() { return estArrete_; }))
+    {
+        verrou.unlock();
+        fusionner();
+        verrou.lock();
+    }
+}
@@ -0,0 +1,434 @@
+/// Instantané binaire des gestionnaires et de l'analyseur de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "Instantane.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "FichierMappe.h"
+
+namespace
+{
+    // Format (entiers en little-endian):
+    //   En-tête: signature (8 octets), version (u32), réservé (u32), taille des données (u64), somme FNV-1a (u64)
+    //   Données: films, utilisateurs puis logs, chaque section précédée de son nombre d'éléments (u64). Les sections
+    //   des films et des utilisateurs commencent par le prochain identifiant dense du gestionnaire (u32) et chaque
+    //   élément y est précédé de son identifiant (u32).
+    //   Une chaîne est écrite comme sa taille (u32) suivie de ses octets. Un log est écrit comme son horodatage en
+    //   secondes (i64) suivi des positions de son utilisateur et de son film (u32).
+    constexpr std::string_view signature("TP5INST", 8); // Inclut le '\0' final
+    constexpr std::size_t tailleEnTete = 32;
+
+    /// Calcule la somme de contrôle FNV-1a 64 bits des octets donnés.
+    /// \param octets   Les octets à résumer.
+    /// \return         La somme de contrôle.
+    std::uint64_t calculerSommeControle(std::string_view octets)
+    {
+        std::uint64_t somme = 14695981039346656037ull;
+        for (char octet : octets)
+        {
+            somme ^= static_cast<unsigned char>(octet);
+            somme *= 1099511628211ull;
+        }
+        return somme;
+    }
+
+    /// Classe qui accumule des valeurs encodées en binaire little-endian.
+    class EcrivainBinaire
+    {
+    public:
+        /// Ajoute un entier non signé encodé sur le nombre d'octets donné.
+        /// \param valeur       La valeur à écrire.
+        /// \param nombreOctets Le nombre d'octets de l'encodage.
+        void ecrireEntier(std::uint64_t valeur, std::size_t nombreOctets)
+        {
+            for (std::size_t i = 0; i < nombreOctets; i++)
+            {
+                octets_.push_back(static_cast<char>((valeur >> (8 * i)) & 0xFF));
+            }
+        }
+
+        /// Ajoute une chaîne précédée de sa taille.
+        /// \param chaine   La chaîne à écrire.
+        void ecrireChaine(std::string_view chaine)
+        {
+            ecrireEntier(chaine.size(), 4);
+            octets_.append(chaine);
+        }
+
+        /// Retourne les octets accumulés.
+        /// \return Une référence aux octets écrits jusqu'à maintenant.
+        const std::string& getOctets() const { return octets_; }
+
+    private:
+        std::string octets_;
+    };
+
+    /// Classe qui décode des valeurs binaires little-endian en vérifiant les bornes. Après une lecture hors bornes,
+    /// toutes les lectures suivantes échouent et estValide() retourne false.
+    class LecteurBinaire
+    {
+    public:
+        /// Constructeur à partir des octets à décoder.
+        /// \param octets   Les octets à décoder, qui doivent rester valides pendant la lecture.
+        explicit LecteurBinaire(std::string_view octets)
+            : octets_(octets)
+        {
+        }
+
+        /// Lit un entier non signé encodé sur le nombre d'octets donné.
+        /// \param nombreOctets Le nombre d'octets de l'encodage.
+        /// \return             La valeur lue, ou 0 si les octets manquent.
+        std::uint64_t lireEntier(std::size_t nombreOctets)
+        {
+            if (!estValide_ || octets_.size() < nombreOctets)
+            {
+                estValide_ = false;
+                return 0;
+            }
+            std::uint64_t valeur = 0;
+            for (std::size_t i = 0; i < nombreOctets; i++)
+            {
+                valeur |= static_cast<std::uint64_t>(static_cast<unsigned char>(octets_[i])) << (8 * i);
+            }
+            octets_.remove_prefix(nombreOctets);
+            return valeur;
+        }
+
+        /// Lit une chaîne précédée de sa taille.
+        /// \return Une vue sur la chaîne dans les octets décodés, vide si les octets manquent.
+        std::string_view lireChaine()
+        {
+            std::size_t taille = static_cast<std::size_t>(lireEntier(4));
+            if (!estValide_ || octets_.size() < taille)
+            {
+                estValide_ = false;
+                return std::string_view();
+            }
+            std::string_view chaine = octets_.substr(0, taille);
+            octets_.remove_prefix(taille);
+            return chaine;
+        }
+
+        /// Lit un nombre d'éléments en vérifiant qu'il est plausible compte tenu des octets restants.
+        /// \param tailleMinimaleElement    Le nombre minimal d'octets qu'occupe chaque élément.
+        /// \return                         Le nombre d'éléments, ou 0 s'il est invalide.
+        std::size_t lireNombreElements(std::size_t tailleMinimaleElement)
+        {
+            std::uint64_t nombre = lireEntier(8);
+            if (nombre > octets_.size() / tailleMinimaleElement)
+            {
+                estValide_ = false;
+                return 0;
+            }
+            return static_cast<std::size_t>(nombre);
+        }
+
+        /// Indique si toutes les lectures ont réussi.
+        /// \return True si aucune lecture n'a dépassé les octets disponibles.
+        bool estValide() const { return estValide_; }
+
+        /// Indique si tous les octets ont été consommés.
+        /// \return True s'il ne reste aucun octet à lire.
+        bool estTermine() const { return octets_.empty(); }
+
+    private:
+        std::string_view octets_;
+        bool estValide_ = true;
+    };
+} // namespace
+
+/// Sauvegarde l'état des deux gestionnaires et de l'analyseur de logs dans un fichier binaire. Le fichier est d'abord
+/// écrit sous un nom temporaire puis renommé, de sorte qu'un instantané existant n'est jamais laissé à moitié écrit.
+/// \param nomFichier               Le fichier dans lequel écrire l'instantané.
+/// \param gestionnaireUtilisateurs Le gestionnaire d'utilisateurs à sauvegarder.
+/// \param gestionnaireFilms        Le gestionnaire de films à sauvegarder.
+/// \param analyseurLogs            L'analyseur de logs à sauvegarder. Ses logs doivent référencer des utilisateurs
+///                                 et des films des deux gestionnaires. Un analyseur en mode approximatif, qui ne
+///                                 conserve pas ses logs, ne peut pas être sauvegardé.
+/// \return                         True si l'instantané a été écrit avec succès, false sinon.
+bool Instantane::sauvegarder(const std::string& nomFichier, const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                             const GestionnaireFilms& gestionnaireFilms, const AnalyseurLogs& analyseurLogs)
+{
+    if (analyseurLogs.estApproximatif())
+    {
+        std::cerr << "Erreur Instantane: un analyseur en mode approximatif ne peut pas être sauvegardé\n";
+        return false;
+    }
+
+    EcrivainBinaire donnees;
+
+    std::unordered_map<const Film*, std::uint32_t> positionsFilms;
+    positionsFilms.reserve(gestionnaireFilms.getNombreFilms());
+    donnees.ecrireEntier(gestionnaireFilms.prochainIndice_, 4);
+    donnees.ecrireEntier(gestionnaireFilms.getNombreFilms(), 8);
+    gestionnaireFilms.films_.pourChaque(
+        [&](const Film& film)
+        {
+            positionsFilms.emplace(&film, static_cast<std::uint32_t>(positionsFilms.size()));
+            donnees.ecrireEntier(film.indice, 4);
+            donnees.ecrireChaine(film.nom);
+            donnees.ecrireEntier(static_cast<std::uint64_t>(film.genre), 1);
+            donnees.ecrireEntier(static_cast<std::uint64_t>(film.pays), 1);
+            donnees.ecrireChaine(film.realisateur.get());
+            donnees.ecrireEntier(static_cast<std::uint32_t>(film.annee), 4);
+        });
+
+    std::unordered_map<const Utilisateur*, std::uint32_t> positionsUtilisateurs;
+    positionsUtilisateurs.reserve(gestionnaireUtilisateurs.getNombreUtilisateurs());
+    donnees.ecrireEntier(gestionnaireUtilisateurs.prochainIndice_, 4);
+    donnees.ecrireEntier(gestionnaireUtilisateurs.getNombreUtilisateurs(), 8);
+    gestionnaireUtilisateurs.entrepotUtilisateurs_.pourChaque(
+        [&](const Utilisateur& utilisateur)
+        {
+            positionsUtilisateurs.emplace(&utilisateur, static_cast<std::uint32_t>(positionsUtilisateurs.size()));
+            donnees.ecrireEntier(utilisateur.indice, 4);
+            donnees.ecrireChaine(utilisateur.id);
+            donnees.ecrireChaine(utilisateur.nom);
+            donnees.ecrireEntier(static_cast<std::uint32_t>(utilisateur.age), 4);
+            donnees.ecrireEntier(static_cast<std::uint64_t>(utilisateur.pays), 1);
+        });
+
+    // Les indices propres à l'analyseur sont traduits une seule fois en positions dans l'instantané. Les indices
+    // inutilisés de l'analyseur ne sont référencés par aucun log.
+    std::vector<std::uint32_t> positionsParIndiceUtilisateur;
+    positionsParIndiceUtilisateur.reserve(analyseurLogs.utilisateurs_.size());
+    for (const Utilisateur* utilisateur : analyseurLogs.utilisateurs_)
+    {
+        if (utilisateur == nullptr)
+        {
+            positionsParIndiceUtilisateur.push_back(0);
+            continue;
+        }
+        auto it = positionsUtilisateurs.find(utilisateur);
+        if (it == positionsUtilisateurs.end())
+        {
+            std::cerr << "Erreur Instantane: un log référence un utilisateur absent du gestionnaire\n";
+            return false;
+        }
+        positionsParIndiceUtilisateur.push_back(it->second);
+    }
+    std::vector<std::uint32_t> positionsParIndiceFilm;
+    positionsParIndiceFilm.reserve(analyseurLogs.films_.size());
+    for (const Film* film : analyseurLogs.films_)
+    {
+        if (film == nullptr)
+        {
+            positionsParIndiceFilm.push_back(0);
+            continue;
+        }
+        auto it = positionsFilms.find(film);
+        if (it == positionsFilms.end())
+        {
+            std::cerr << "Erreur Instantane: un log référence un film absent du gestionnaire\n";
+            return false;
+        }
+        positionsParIndiceFilm.push_back(it->second);
+    }
+
+    donnees.ecrireEntier(analyseurLogs.logs_.getNombreEntrees(), 8);
+    for (std::size_t i = 0; i < analyseurLogs.logs_.getNombreEntrees(); i++)
+    {
+        EntreeLog entreeLog = analyseurLogs.logs_.getEntree(i);
+        donnees.ecrireEntier(static_cast<std::uint64_t>(entreeLog.timestamp), 8);
+        donnees.ecrireEntier(positionsParIndiceUtilisateur[entreeLog.utilisateur], 4);
+        donnees.ecrireEntier(positionsParIndiceFilm[entreeLog.film], 4);
+    }
+
+    EcrivainBinaire enTete;
+    for (char caractere : signature)
+    {
+        enTete.ecrireEntier(static_cast<unsigned char>(caractere), 1);
+    }
+    enTete.ecrireEntier(version, 4);
+    enTete.ecrireEntier(0, 4);
+    enTete.ecrireEntier(donnees.getOctets().size(), 8);
+    enTete.ecrireEntier(calculerSommeControle(donnees.getOctets()), 8);
+
+    std::string nomFichierTemporaire = nomFichier + ".tmp";
+    {
+        std::ofstream fichier(nomFichierTemporaire, std::ios::binary | std::ios::trunc);
+        fichier.write(enTete.getOctets().data(), static_cast<std::streamsize>(enTete.getOctets().size()));
+        fichier.write(donnees.getOctets().data(), static_cast<std::streamsize>(donnees.getOctets().size()));
+        if (!fichier.flush())
+        {
+            std::cerr << "Erreur Instantane: le fichier " << nomFichier << " n'a pas pu être écrit\n";
+            std::remove(nomFichierTemporaire.c_str());
+            return false;
+        }
+    }
+    if (std::rename(nomFichierTemporaire.c_str(), nomFichier.c_str()) != 0)
+    {
+        // Sous Windows, rename échoue si la destination existe déjà
+        std::remove(nomFichier.c_str());
+        if (std::rename(nomFichierTemporaire.c_str(), nomFichier.c_str()) != 0)
+        {
+            std::cerr << "Erreur Instantane: le fichier " << nomFichier << " n'a pas pu être écrit\n";
+            std::remove(nomFichierTemporaire.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Restaure l'état des deux gestionnaires et de l'analyseur de logs à partir d'un fichier binaire. Le fichier est
+/// validé et décodé au complet avant toute modification: en cas d'erreur, les trois objets restent inchangés.
+/// \param nomFichier               Le fichier à partir duquel lire l'instantané.
+/// \param gestionnaireUtilisateurs Le gestionnaire d'utilisateurs à remplacer.
+/// \param gestionnaireFilms        Le gestionnaire de films à remplacer.
+/// \param analyseurLogs            L'analyseur de logs à remplacer.
+/// \return                         True si l'instantané a été restauré avec succès, false sinon.
+bool Instantane::charger(const std::string& nomFichier, GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                         GestionnaireFilms& gestionnaireFilms, AnalyseurLogs& analyseurLogs)
+{
+    FichierMappe fichier(nomFichier);
+    if (!fichier.estOuvert())
+    {
+        std::cerr << "Erreur Instantane: le fichier " << nomFichier << " n'a pas pu être ouvert\n";
+        return false;
+    }
+
+    std::string_view contenu = fichier.getContenu();
+    LecteurBinaire enTete(contenu.substr(0, tailleEnTete));
+    std::string_view signatureLue = contenu.substr(0, signature.size());
+    enTete.lireEntier(signature.size());
+    std::uint64_t versionLue = enTete.lireEntier(4);
+    enTete.lireEntier(4);
+    std::uint64_t tailleDonnees = enTete.lireEntier(8);
+    std::uint64_t sommeControle = enTete.lireEntier(8);
+    if (!enTete.estValide() || signatureLue != signature)
+    {
+        std::cerr << "Erreur Instantane: le fichier " << nomFichier << " n'est pas un instantané\n";
+        return false;
+    }
+    if (versionLue != version)
+    {
+        std::cerr << "Erreur Instantane: la version " << versionLue << " du fichier " << nomFichier
+                  << " n'est pas supportée\n";
+        return false;
+    }
+    std::string_view donnees = contenu.substr(tailleEnTete);
+    if (tailleDonnees != donnees.size() || sommeControle != calculerSommeControle(donnees))
+    {
+        std::cerr << "Erreur Instantane: le fichier " << nomFichier << " est corrompu\n";
+        return false;
+    }
+
+    // Taille minimale encodée d'un film, d'un utilisateur et d'un log (chaînes vides)
+    static constexpr std::size_t tailleMinimaleFilm = 4 + 4 + 1 + 1 + 4 + 4;
+    static constexpr std::size_t tailleMinimaleUtilisateur = 4 + 4 + 4 + 4 + 1;
+    static constexpr std::size_t tailleMinimaleLog = 8 + 4 + 4;
+
+    LecteurBinaire lecteur(donnees);
+    bool estCoherent = true;
+
+    GestionnaireFilms films;
+    films.prochainIndice_ = static_cast<std::uint32_t>(lecteur.lireEntier(4));
+    std::vector<const Film*> filmsParPosition(lecteur.lireNombreElements(tailleMinimaleFilm));
+    films.films_.reserver(filmsParPosition.size());
+    films.filtreNomFilms_.reserver(filmsParPosition.size());
+    std::unordered_set<std::uint32_t> indicesFilms;
+    for (auto& filmParPosition : filmsParPosition)
+    {
+        Film film;
+        film.indice = static_cast<std::uint32_t>(lecteur.lireEntier(4));
+        film.nom = lecteur.lireChaine();
+        film.genre = static_cast<Film::Genre>(lecteur.lireEntier(1));
+        film.pays = static_cast<Pays>(lecteur.lireEntier(1));
+        film.realisateur = ChaineInternee(lecteur.lireChaine());
+        film.annee = static_cast<int>(static_cast<std::int32_t>(lecteur.lireEntier(4)));
+        if (film.indice >= films.prochainIndice_ || !estGenreValide(film.genre) || !estPaysValide(film.pays) ||
+            !indicesFilms.insert(film.indice).second || films.getFilmParNom(film.nom) != nullptr)
+        {
+            estCoherent = false;
+            break;
+        }
+        filmParPosition = films.indexerFilm(film);
+    }
+    // Les indices sans film, laissés par des suppressions avant la sauvegarde, sont attribués aux prochains ajouts
+    films.prochainIndice_ = static_cast<std::uint32_t>(films.filmsParIndice_.size());
+    for (std::uint32_t indice = films.prochainIndice_; indice-- > 0;)
+    {
+        if (films.filmsParIndice_[indice] == nullptr)
+        {
+            films.indicesLibres_.push_back(indice);
+        }
+    }
+
+    GestionnaireUtilisateurs utilisateurs;
+    utilisateurs.prochainIndice_ = static_cast<std::uint32_t>(lecteur.lireEntier(4));
+    std::vector<const Utilisateur*> utilisateursParPosition(lecteur.lireNombreElements(tailleMinimaleUtilisateur));
+    utilisateurs.utilisateurs_.reserver(utilisateursParPosition.size());
+    utilisateurs.entrepotUtilisateurs_.reserver(utilisateursParPosition.size());
+    std::unordered_set<std::uint32_t> indicesUtilisateurs;
+    for (auto& utilisateurParPosition : utilisateursParPosition)
+    {
+        Utilisateur utilisateur;
+        utilisateur.indice = static_cast<std::uint32_t>(lecteur.lireEntier(4));
+        if (utilisateur.indice >= utilisateurs.prochainIndice_ || !indicesUtilisateurs.insert(utilisateur.indice).second)
+        {
+            estCoherent = false;
+            break;
+        }
+        utilisateur.id = lecteur.lireChaine();
+        utilisateur.nom = lecteur.lireChaine();
+        utilisateur.age = static_cast<int>(static_cast<std::int32_t>(lecteur.lireEntier(4)));
+        utilisateur.pays = static_cast<Pays>(lecteur.lireEntier(1));
+        if (!estPaysValide(utilisateur.pays) ||
+            utilisateurs.getUtilisateurParId(utilisateur.id) != nullptr)
+        {
+            estCoherent = false;
+            break;
+        }
+        utilisateurParPosition = utilisateurs.indexerUtilisateur(std::move(utilisateur));
+    }
+    // Un film ou un utilisateur rejeté laisse des positions sans élément, que les logs ne doivent pas référencer
+    if (!estCoherent || !lecteur.estValide())
+    {
+        std::cerr << "Erreur Instantane: le fichier " << nomFichier << " est incohérent\n";
+        return false;
+    }
+    for (std::uint32_t indice = utilisateurs.prochainIndice_; indice-- > 0;)
+    {
+        if (indicesUtilisateurs.count(indice) == 0)
+        {
+            utilisateurs.indicesLibres_.push_back(indice);
+        }
+    }
+
+    AnalyseurLogs logs;
+    std::vector<EntreeLog> entreesLog(lecteur.lireNombreElements(tailleMinimaleLog));
+    for (auto& entreeLog : entreesLog)
+    {
+        auto timestamp = static_cast<std::int64_t>(lecteur.lireEntier(8));
+        std::uint64_t positionUtilisateur = lecteur.lireEntier(4);
+        std::uint64_t positionFilm = lecteur.lireEntier(4);
+        if (positionUtilisateur >= utilisateursParPosition.size() || positionFilm >= filmsParPosition.size() ||
+            utilisateursParPosition[positionUtilisateur] == nullptr || filmsParPosition[positionFilm] == nullptr)
+        {
+            estCoherent = false;
+            break;
+        }
+        entreeLog = logs.creerEntreeLog(timestamp, utilisateursParPosition[positionUtilisateur],
+                                        filmsParPosition[positionFilm]);
+    }
+
+    if (!estCoherent || !lecteur.estValide() || !lecteur.estTermine())
+    {
+        std::cerr << "Erreur Instantane: le fichier " << nomFichier << " est incohérent\n";
+        return false;
+    }
+
+    logs.ajouterEntreesLog(std::move(entreesLog));
+
+    // Les déplacements conservent l'adresse des films et des utilisateurs référencés par les logs
+    gestionnaireFilms = std::move(films);
+    gestionnaireUtilisateurs = std::move(utilisateurs);
+    analyseurLogs = std::move(logs);
+    return true;
+}
@@ -0,0 +1,16 @@
+/// Fonctions auxiliaires à la struct pour les lignes de log.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "LigneLog.h"
+
+/// Affiche les informations d'une ligne de log à la sortie du stream donné.
+/// \param outputStream Le stream auquel écrire les informations de la ligne de log.
+/// \param ligneLog     La ligne de log à afficher au stream.
+/// \return             Une référence au stream.
+std::ostream& operator<<(std::ostream& outputStream, const LigneLog& ligneLog)
+{
+    outputStream << "Timestamp: " << ligneLog.timestamp << " | Utilisateur: " << ligneLog.utilisateur->id
+                 << " | Film: " << ligneLog.film->nom;
+    return outputStream;
+}
@@ -6,6 +6,14 @@
 #include <string>
 #include <unordered_map>
 
+/// Indique si un pays, par exemple lu d'un fichier, correspond à une valeur du enum.
+/// \param pays Le pays à vérifier.
+/// \return     True si le pays peut servir d'indice dans un tableau de nombrePays éléments.
+bool estPaysValide(Pays pays)
+{
+    return static_cast<std::size_t>(pays) < nombrePays;
+}
+
 /// Convertit la valeur du enum Pays en string.
 /// \param pays Le pays à convertir.
 /// \return     String représentant le enum.
@@ -0,0 +1,39 @@
+/// Statistiques de débit d'un chargement de fichier.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "StatistiquesChargement.h"
+
+/// Calcule le débit en lignes par seconde du chargement.
+/// \return Le nombre de lignes traitées par seconde, ou 0 si la durée est nulle.
+double StatistiquesChargement::getLignesParSeconde() const
+{
+    if (dureeSecondes <= 0.0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(nombreLignes) / dureeSecondes;
+}
+
+/// Calcule le débit en octets par seconde du chargement.
+/// \return Le nombre d'octets traités par seconde, ou 0 si la durée est nulle.
+double StatistiquesChargement::getOctetsParSeconde() const
+{
+    if (dureeSecondes <= 0.0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(nombreOctets) / dureeSecondes;
+}
+
+/// Affiche les statistiques de chargement à la sortie du stream donné.
+/// \param outputStream Le stream auquel écrire les statistiques.
+/// \param statistiques Les statistiques à afficher au stream.
+/// \return             Une référence au stream.
+std::ostream& operator<<(std::ostream& outputStream, const StatistiquesChargement& statistiques)
+{
+    outputStream << statistiques.nombreLignes << " lignes (" << statistiques.nombreOctets << " octets) en "
+                 << statistiques.dureeSecondes << " s | " << statistiques.getLignesParSeconde() << " lignes/s | "
+                 << statistiques.getOctetsParSeconde() / (1024.0 * 1024.0) << " Mo/s";
+    return outputStream;
+}
@@ -0,0 +1,98 @@
+/// Suivi continu d'un fichier de logs.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "SuiviLogs.h"
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+/// Constructeur qui associe le suivi à un fichier et à l'analyseur à alimenter. Aucune lecture n'est faite avant le
+/// premier rafraîchissement.
+/// \param nomFichier               Le fichier de logs à suivre.
+/// \param analyseurLogs            L'analyseur dans lequel ingérer les nouvelles lignes.
+/// \param gestionnaireUtilisateurs Le gestionnaire des utilisateurs pour lier un utilisateur à un log.
+/// \param gestionnaireFilms        Le gestionnaire des films pour lier un film à un log.
+/// \param intervalle               L'intervalle minimal entre deux lectures pour rafraichirSiEcheance et suivre.
+SuiviLogs::SuiviLogs(const std::string& nomFichier, AnalyseurLogs& analyseurLogs,
+                     const GestionnaireUtilisateurs& gestionnaireUtilisateurs,
+                     const GestionnaireFilms& gestionnaireFilms, std::chrono::milliseconds intervalle)
+    : nomFichier_(nomFichier)
+    , analyseurLogs_(&analyseurLogs)
+    , gestionnaireUtilisateurs_(&gestionnaireUtilisateurs)
+    , gestionnaireFilms_(&gestionnaireFilms)
+    , intervalle_(intervalle)
+    , prochaineEcheance_(std::chrono::steady_clock::now())
+{
+}
+
+/// Lit les octets ajoutés au fichier depuis la dernière lecture et ingère les lignes complètes. Une dernière ligne
+/// sans '\n' est considérée en cours d'écriture et sera lue au prochain rafraîchissement.
+/// \return True si le fichier a pu être lu et que toutes les nouvelles lignes ont été interprétées, false sinon.
+bool SuiviLogs::rafraichir()
+{
+    prochaineEcheance_ = std::chrono::steady_clock::now() + intervalle_;
+
+    std::ifstream fichier(nomFichier_, std::ios::binary | std::ios::ate);
+    if (!fichier)
+    {
+        std::cerr << "Erreur SuiviLogs: le fichier " << nomFichier_ << " n'a pas pu être ouvert\n";
+        return false;
+    }
+
+    auto taille = static_cast<std::uintmax_t>(fichier.tellg());
+    if (!estCommence_ || taille < position_)
+    {
+        analyseurLogs_->effacer();
+        position_ = 0;
+        estCommence_ = true;
+    }
+    if (taille == position_)
+    {
+        return true;
+    }
+
+    tampon_.resize(static_cast<std::size_t>(taille - position_));
+    fichier.seekg(static_cast<std::streamoff>(position_));
+    fichier.read(tampon_.data(), static_cast<std::streamsize>(tampon_.size()));
+    tampon_.resize(static_cast<std::size_t>(fichier.gcount()));
+
+    std::size_t finDerniereLigne = tampon_.rfind('\n');
+    if (finDerniereLigne == std::string::npos)
+    {
+        return true;
+    }
+    std::string_view lignesCompletes(tampon_.data(), finDerniereLigne + 1);
+    position_ += lignesCompletes.size();
+    return analyseurLogs_->ajouterLignesDepuisTexte(lignesCompletes, *gestionnaireUtilisateurs_,
+                                                    *gestionnaireFilms_);
+}
+
+/// Rafraîchit seulement si l'intervalle de sondage est écoulé depuis la dernière lecture.
+/// \return True si aucune lecture n'était due ou si la lecture a réussi, false sinon.
+bool SuiviLogs::rafraichirSiEcheance()
+{
+    if (std::chrono::steady_clock::now() < prochaineEcheance_)
+    {
+        return true;
+    }
+    return rafraichir();
+}
+
+/// Sonde le fichier à chaque intervalle sur le thread appelant jusqu'à ce que le drapeau passe à false.
+/// \param continuer    Drapeau consulté entre deux lectures pour arrêter le suivi.
+void SuiviLogs::suivre(const std::atomic<bool>& continuer)
+{
+    while (continuer.load())
+    {
+        rafraichirSiEcheance();
+        std::this_thread::sleep_until(prochaineEcheance_);
+    }
+}
+
+/// Retourne la position dans le fichier jusqu'à laquelle les lignes ont été ingérées.
+/// \return Le nombre d'octets déjà ingérés.
+std::uintmax_t SuiviLogs::getPosition() const
+{
+    return position_;
+}
@@ -0,0 +1,87 @@
+/// Popularité des films sur une fenêtre de temps glissante.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "TendancesFilms.h"
+#include <limits>
+
+/// Constructeur à partir de la durée de la fenêtre.
+/// \param dureeFenetre La durée de la fenêtre en secondes, strictement positive.
+TendancesFilms::TendancesFilms(std::int64_t dureeFenetre)
+    : dureeFenetre_(dureeFenetre)
+    , limite_(std::numeric_limits<std::int64_t>::min())
+{
+}
+
+/// Reconstruit la fenêtre à partir de toutes les entrées du log, en O(taille de la fenêtre).
+/// \param logs Les colonnes du log.
+void TendancesFilms::initialiser(const ColonnesLogs& logs)
+{
+    effacer();
+    if (logs.estVide())
+    {
+        return;
+    }
+    limite_ = logs.getTimestamps().back() - dureeFenetre_;
+    debutFenetre_ = logs.getTranche(std::numeric_limits<std::int64_t>::min(), limite_ + 1).getNombreEntrees();
+    for (std::size_t i = debutFenetre_; i < logs.getNombreEntrees(); i++)
+    {
+        classement_.ajouterVue(logs.getFilms()[i]);
+    }
+}
+
+/// Comptabilise une entrée qui vient d'être insérée dans le log. Une entrée déjà expirée est placée avant la fenêtre
+/// dans le log et en décale seulement le début. Appeler avancer() une fois les entrées d'un lot comptabilisées.
+/// \param entreeLog    L'entrée insérée.
+void TendancesFilms::comptabiliserEntreeLog(const EntreeLog& entreeLog)
+{
+    if (entreeLog.timestamp > limite_)
+    {
+        classement_.ajouterVue(entreeLog.film);
+    }
+    else
+    {
+        debutFenetre_++;
+    }
+}
+
+/// Fait glisser la fenêtre jusqu'à l'horodatage le plus récent du log en expirant les vues qui en sortent. Chaque
+/// entrée n'expire qu'une fois, d'où un coût O(1) amorti par vue.
+/// \param logs Les colonnes du log, qui contiennent toutes les entrées comptabilisées.
+void TendancesFilms::avancer(const ColonnesLogs& logs)
+{
+    if (logs.estVide() || logs.getTimestamps().back() - dureeFenetre_ <= limite_)
+    {
+        return;
+    }
+    limite_ = logs.getTimestamps().back() - dureeFenetre_;
+    const std::vector<std::int64_t>& timestamps = logs.getTimestamps();
+    const std::vector<std::uint32_t>& films = logs.getFilms();
+    while (debutFenetre_ < timestamps.size() && timestamps[debutFenetre_] <= limite_)
+    {
+        classement_.retirerVue(films[debutFenetre_]);
+        debutFenetre_++;
+    }
+}
+
+/// Vide la fenêtre en conservant sa durée.
+void TendancesFilms::effacer()
+{
+    debutFenetre_ = 0;
+    limite_ = std::numeric_limits<std::int64_t>::min();
+    classement_.effacer();
+}
+
+/// Retourne la durée de la fenêtre.
+/// \return La durée en secondes.
+std::int64_t TendancesFilms::getDureeFenetre() const
+{
+    return dureeFenetre_;
+}
+
+/// Retourne le classement des films vus dans la fenêtre.
+/// \return Le classement par indice de film.
+const ClassementPopularite& TendancesFilms::getClassement() const
+{
+    return classement_;
+}
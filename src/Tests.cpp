@@ -5,14 +5,29 @@
 #include "Tests.h"
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <random>
+#include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include "AnalyseurLogs.h"
+#include "CatalogueConcurrent.h"
 #include "Foncteurs.h"
 #include "GestionnaireFilms.h"
 #include "GestionnaireUtilisateurs.h"
+#include "Horodatage.h"
+#include "IngestionLogs.h"
+#include "Instantane.h"
+#include "SuiviLogs.h"
 
 namespace
 {
@@ -236,6 +251,167 @@ namespace Tests
         tests.push_back(sortieRecue == sortieAttendue);
         afficherResultatTest(5, "GestionnaireUtilisateurs::operator<<", tests.back());
 
+        // Test 6
+        static const std::string nomFichierUtilisateurs = "utilisateurs_test_parallele.txt";
+        {
+            std::ofstream fichierUtilisateurs(nomFichierUtilisateurs);
+            for (int i = 0; i < 50; i++)
+            {
+                fichierUtilisateurs << "id" << i << "@email.com \"Prénom " << i << "\" " << i << ' ' << i % 9 << '\n';
+            }
+            fichierUtilisateurs << "ligne invalide\n"
+                                << "horspays@email.com \"Hors pays\" 30 " << nombrePays << '\n'
+                                << "id3@email.com \"Doublon\" 99 1";
+        }
+        GestionnaireUtilisateurs gestionnaireSequentiel;
+        GestionnaireUtilisateurs gestionnaireParallele;
+        bool chargementSequentiel = gestionnaireSequentiel.chargerDepuisFichier(nomFichierUtilisateurs);
+        bool chargementParallele = gestionnaireParallele.chargerDepuisFichierParallele(nomFichierUtilisateurs, 4);
+        std::remove(nomFichierUtilisateurs.c_str());
+        const Utilisateur* doublon = gestionnaireParallele.getUtilisateurParId("id3@email.com");
+        std::ostringstream sortieSequentielle;
+        std::ostringstream sortieParallele;
+        sortieSequentielle << gestionnaireSequentiel;
+        sortieParallele << gestionnaireParallele;
+        tests.push_back(!chargementSequentiel && !chargementParallele &&
+                        gestionnaireParallele.getNombreUtilisateurs() == 50 && doublon != nullptr &&
+                        doublon->nom == "Prénom 3" && sortieSequentielle.str().size() == sortieParallele.str().size() &&
+                        gestionnaireSequentiel.getUtilisateurParId("horspays@email.com") == nullptr &&
+                        gestionnaireParallele.getUtilisateurParId("horspays@email.com") == nullptr &&
+                        !gestionnaireParallele.ajouterUtilisateur(
+                            Utilisateur{"horspays@email.com", "Hors pays", 30, static_cast<Pays>(-1)}) &&
+                        gestionnaireParallele.getHistogrammeAges(static_cast<Pays>(nombrePays)).empty());
+        afficherResultatTest(6, "GestionnaireUtilisateurs::chargerDepuisFichierParallele", tests.back());
+
+        // Test 7
+        GestionnaireUtilisateurs gestionnaireIndices;
+        gestionnaireIndices.ajouterUtilisateur(Utilisateur{"a@email.com", "A", 20, Pays::Canada});
+        gestionnaireIndices.ajouterUtilisateur(Utilisateur{"b@email.com", "B", 20, Pays::Canada});
+        gestionnaireIndices.supprimerUtilisateur("a@email.com");
+        gestionnaireIndices.ajouterUtilisateur(Utilisateur{"c@email.com", "C", 20, Pays::Canada, 42});
+        GestionnaireUtilisateurs copieIndices = gestionnaireIndices;
+        copieIndices.ajouterUtilisateur(Utilisateur{"d@email.com", "D", 20, Pays::Canada});
+        // Des utilisateurs sans cesse remplacés réutilisent les indices libérés, qui restent bornés
+        GestionnaireUtilisateurs gestionnaireRotation;
+        for (int i = 0; i < 3'000; i++)
+        {
+            gestionnaireRotation.ajouterUtilisateur(
+                Utilisateur{"rotation" + std::to_string(i) + "@email.com", "Rotation", i % 100, Pays::Canada});
+            if (i >= 100)
+            {
+                gestionnaireRotation.supprimerUtilisateur("rotation" + std::to_string(i - 100) + "@email.com");
+            }
+        }
+        bool rotationValide = gestionnaireRotation.getNombreUtilisateurs() == 100 &&
+                              gestionnaireRotation.getNombreUtilisateursParPays(Pays::Canada) == 100;
+        for (int i = 2'900; i < 3'000; i++)
+        {
+            const Utilisateur* utilisateur =
+                gestionnaireRotation.getUtilisateurParId("rotation" + std::to_string(i) + "@email.com");
+            rotationValide = rotationValide && utilisateur->indice <= 100 &&
+                             gestionnaireRotation.getUtilisateursParPays(Pays::Canada, i % 100, i % 100) ==
+                                 std::vector<const Utilisateur*>{utilisateur};
+        }
+        tests.push_back(gestionnaireIndices.getUtilisateurParId("b@email.com")->indice == 1 &&
+                        gestionnaireIndices.getUtilisateurParId("c@email.com")->indice == 0 &&
+                        copieIndices.getUtilisateurParId("c@email.com")->indice == 0 &&
+                        copieIndices.getUtilisateurParId("d@email.com")->indice == 2 && rotationValide);
+        afficherResultatTest(7, "Utilisateur::indice", tests.back());
+
+        // Test 8
+        GestionnaireUtilisateurs gestionnaireIndex;
+        std::set<std::string> idsPresents;
+        bool indexValide = true;
+        std::mt19937 generateurIndex(7);
+        std::uniform_int_distribution<int> distributionIds(0, 2999);
+        for (int i = 0; i < 20'000; i++)
+        {
+            std::string id = "id" + std::to_string(distributionIds(generateurIndex)) + "@email.com";
+            if (i % 3 == 2)
+            {
+                bool estSupprime = gestionnaireIndex.supprimerUtilisateur(id);
+                indexValide = indexValide && estSupprime == (idsPresents.erase(id) == 1);
+            }
+            else
+            {
+                bool estAjoute = gestionnaireIndex.ajouterUtilisateur(Utilisateur{id, "Nom", 30, Pays::Japon});
+                indexValide = indexValide && estAjoute == idsPresents.insert(id).second;
+            }
+        }
+        indexValide = indexValide && gestionnaireIndex.getNombreUtilisateurs() == idsPresents.size();
+        static constexpr std::string_view tamponIds = "id12@email.com id3000@email.com";
+        for (int i = 0; i < 3001; i++)
+        {
+            std::string id = "id" + std::to_string(i) + "@email.com";
+            const Utilisateur* utilisateur = gestionnaireIndex.getUtilisateurParId(id);
+            indexValide = indexValide && (utilisateur != nullptr) == (idsPresents.count(id) == 1) &&
+                          (utilisateur == nullptr || utilisateur->id == id);
+        }
+        indexValide = indexValide && gestionnaireIndex.getUtilisateurParId(tamponIds.substr(0, 14)) ==
+                                         gestionnaireIndex.getUtilisateurParId("id12@email.com") &&
+                      gestionnaireIndex.getUtilisateurParId(tamponIds.substr(15)) == nullptr;
+        tests.push_back(indexValide);
+        afficherResultatTest(8, "GestionnaireUtilisateurs index par id", tests.back());
+
+        // Test 9
+        GestionnaireUtilisateurs gestionnaireAudience;
+        std::map<std::string, std::pair<Pays, int>> utilisateursAttendus;
+        for (int i = 0; i < 5'000; i++)
+        {
+            std::string id = "id" + std::to_string(distributionIds(generateurIndex)) + "@email.com";
+            if (i % 4 == 3)
+            {
+                gestionnaireAudience.supprimerUtilisateur(id);
+                utilisateursAttendus.erase(id);
+            }
+            else
+            {
+                auto pays = static_cast<Pays>(generateurIndex() % nombrePays);
+                int age = 13 + static_cast<int>(generateurIndex() % 60);
+                if (gestionnaireAudience.ajouterUtilisateur(Utilisateur{id, "Nom", age, pays}))
+                {
+                    utilisateursAttendus.emplace(id, std::pair(pays, age));
+                }
+            }
+        }
+        const GestionnaireUtilisateurs copieAudience = gestionnaireAudience;
+        bool audienceValide = copieAudience.getUtilisateursEntreAges(0, 100).size() == utilisateursAttendus.size() &&
+                              copieAudience.getUtilisateursParPays(Pays::Japon, 30, 20).empty();
+        for (std::size_t i = 0; i < nombrePays && audienceValide; i++)
+        {
+            auto pays = static_cast<Pays>(i);
+            std::map<int, std::size_t> histogrammeAttendu;
+            std::set<std::string> idsAttendus;
+            for (const auto& [id, paysAge] : utilisateursAttendus)
+            {
+                if (paysAge.first == pays)
+                {
+                    histogrammeAttendu[paysAge.second]++;
+                    if (paysAge.second >= 18 && paysAge.second <= 24)
+                    {
+                        idsAttendus.insert(id);
+                    }
+                }
+            }
+            std::vector<const Utilisateur*> utilisateursTrouves = copieAudience.getUtilisateursParPays(pays, 18, 24);
+            std::set<std::string> idsTrouves;
+            for (const Utilisateur* utilisateur : utilisateursTrouves)
+            {
+                idsTrouves.insert(utilisateur->id);
+                audienceValide = audienceValide && copieAudience.getUtilisateurParId(utilisateur->id) == utilisateur;
+            }
+            audienceValide = audienceValide && idsTrouves == idsAttendus &&
+                             utilisateursTrouves.size() == idsAttendus.size() &&
+                             std::is_sorted(utilisateursTrouves.begin(), utilisateursTrouves.end(),
+                                            [](const Utilisateur* utilisateur1, const Utilisateur* utilisateur2)
+                                            { return utilisateur1->age < utilisateur2->age; }) &&
+                             copieAudience.getNombreUtilisateursParPays(pays, 18, 24) == idsAttendus.size() &&
+                             copieAudience.getHistogrammeAges(pays) == histogrammeAttendu &&
+                             gestionnaireAudience.getHistogrammeAges(pays) == histogrammeAttendu;
+        }
+        tests.push_back(audienceValide);
+        afficherResultatTest(9, "GestionnaireUtilisateurs index par pays et âge", tests.back());
+
         int nombreTestsReussis = static_cast<int>(std::count(tests.begin(), tests.end(), true));
         double totalPointsSection =
             static_cast<double>(nombreTestsReussis) / static_cast<double>(tests.size()) * maxPointsSection;
@@ -258,22 +434,22 @@ namespace Tests
         std::vector<bool> tests;
 
         // Test 1
-        auto film1 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970});
-        auto film2 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1980});
-        auto film3 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1981});
-        auto film4 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1990});
-        auto film5 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1999});
-        auto film6 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 2000});
-        auto film7 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 2010});
-        const auto film8 =
-            std::make_unique<Film>(Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1995});
+        auto film1 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970});
+        auto film2 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1980});
+        auto film3 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1981});
+        auto film4 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1990});
+        auto film5 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1999});
+        auto film6 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 2000});
+        auto film7 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 2010});
+        const auto film8 = std::make_unique<Film>(
+            Film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1995});
         int anneeInferieure = 1980;
         int anneeSuperieure = 2000;
         EstDansIntervalleDatesFilm foncteurIntervalle(anneeInferieure, anneeSuperieure);
@@ -291,7 +467,7 @@ namespace Tests
 
         // Test 2
         Utilisateur utilisateur{"prénom.nom.@email.com", "Prénom Nom", 20, Pays::Canada};
-        Film film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film film{"Nom", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         LigneLog ligneLog1{"2018-01-01T14:54:19Z", &utilisateur, &film};
         LigneLog ligneLog2{"2018-04-01T14:54:19Z", &utilisateur, &film};
         const LigneLog ligneLog3{"2018-06-01T14:54:19Z", &utilisateur, &film};
@@ -337,8 +513,8 @@ namespace Tests
         GestionnaireFilms gestionnaireFilms;
 
         // Test 1
-        Film film1{"Nom1", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film2{"Nom2", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film film1{"Nom1", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film2{"Nom2", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         bool ajout1 = gestionnaireFilms.ajouterFilm(film1);
         bool ajout2 = gestionnaireFilms.ajouterFilm(film1);
         bool ajout3 = gestionnaireFilms.ajouterFilm(film2);
@@ -346,7 +522,7 @@ namespace Tests
         afficherResultatTest(1, "GestionnaireFilms::ajouterFilm", tests.back());
 
         // Test 2
-        Film film3{"Nom3", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film film3{"Nom3", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         bool suppression1 = gestionnaireFilms.supprimerFilm(film1.nom);
         bool suppression2 = gestionnaireFilms.supprimerFilm(film1.nom);
         bool suppression3 = gestionnaireFilms.supprimerFilm(film2.nom);
@@ -364,8 +540,8 @@ namespace Tests
         afficherResultatTest(3, "GestionnaireFilms::getNombreFilms", tests.back());
 
         // Test 4
-        Film film4{"Nom4", Film::Genre::Horreur, Pays::Japon, "RéalisateurUnique", 1920};
-        Film film5{"Nom5", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film film4{"Nom4", Film::Genre::Horreur, Pays::Japon, ChaineInternee("RéalisateurUnique"), 1920};
+        Film film5{"Nom5", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         gestionnaireFilms.ajouterFilm(film4);
         const Film* filmTrouve1 = gestionnaireFilms.getFilmParNom(film4.nom);
         bool filmTrouve1EstIdentique = filmTrouve1 != nullptr && filmTrouve1->nom == film4.nom &&
@@ -379,11 +555,11 @@ namespace Tests
         afficherResultatTest(4, "GestionnaireFilms::getFilmParNom", tests.back());
 
         // Test 5
-        std::vector<const Film*> filmsParGenre1 = gestionnaireFilms.getFilmsParGenre(Film::Genre::ScienceFiction);
-        Film film6{"Nom6", Film::Genre::Drame, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film7{"Nom7", Film::Genre::Drame, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film8{"Nom8", Film::Genre::Drame, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film9{"Nom9", Film::Genre::Drame, Pays::RoyaumeUni, "Réalisateur", 1970};
+        VueFilms filmsParGenre1 = gestionnaireFilms.getFilmsParGenre(Film::Genre::ScienceFiction);
+        Film film6{"Nom6", Film::Genre::Drame, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film7{"Nom7", Film::Genre::Drame, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film8{"Nom8", Film::Genre::Drame, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film9{"Nom9", Film::Genre::Drame, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         gestionnaireFilms.ajouterFilm(film6);
         gestionnaireFilms.ajouterFilm(film7);
         gestionnaireFilms.ajouterFilm(film8);
@@ -392,22 +568,23 @@ namespace Tests
         const Film* pointeurFilm7 = gestionnaireFilms.getFilmParNom(film7.nom);
         const Film* pointeurFilm8 = gestionnaireFilms.getFilmParNom(film8.nom);
         const Film* pointeurFilm9 = gestionnaireFilms.getFilmParNom(film9.nom);
-        std::vector<const Film*> filmsParGenre2 = gestionnaireFilms.getFilmsParGenre(Film::Genre::Drame);
+        VueFilms filmsParGenre2 = gestionnaireFilms.getFilmsParGenre(Film::Genre::Drame);
         std::vector<const Film*> filmsParGenre2Attendus = {pointeurFilm6, pointeurFilm7, pointeurFilm8, pointeurFilm9};
         bool filmsParGenre2Valides = filmsParGenre2 == filmsParGenre2Attendus;
         gestionnaireFilms.supprimerFilm(film7.nom);
-        std::vector<const Film*> filmsParGenre3 = gestionnaireFilms.getFilmsParGenre(Film::Genre::Drame);
+        VueFilms filmsParGenre3 = gestionnaireFilms.getFilmsParGenre(Film::Genre::Drame);
         std::vector<const Film*> filmsParGenre3Attendus = {pointeurFilm6, pointeurFilm8, pointeurFilm9};
-        bool filmsParGenre3Valides = filmsParGenre3 == filmsParGenre3Attendus;
+        bool filmsParGenre3Valides = std::is_permutation(filmsParGenre3.begin(), filmsParGenre3.end(),
+                                                         filmsParGenre3Attendus.begin(), filmsParGenre3Attendus.end());
         tests.push_back(filmsParGenre1.empty() && filmsParGenre2Valides && filmsParGenre3Valides);
         afficherResultatTest(5, "GestionnaireFilms::getFilmsParGenre", tests.back());
 
         // Test 6
-        std::vector<const Film*> filmsParPays1 = gestionnaireFilms.getFilmsParPays(Pays::Bresil);
-        Film film10{"Nom10", Film::Genre::Documentaire, Pays::Russie, "Réalisateur", 1970};
-        Film film11{"Nom11", Film::Genre::Documentaire, Pays::Russie, "Réalisateur", 1970};
-        Film film12{"Nom12", Film::Genre::Documentaire, Pays::Russie, "Réalisateur", 1970};
-        Film film13{"Nom13", Film::Genre::Documentaire, Pays::Russie, "Réalisateur", 1970};
+        VueFilms filmsParPays1 = gestionnaireFilms.getFilmsParPays(Pays::Bresil);
+        Film film10{"Nom10", Film::Genre::Documentaire, Pays::Russie, ChaineInternee("Réalisateur"), 1970};
+        Film film11{"Nom11", Film::Genre::Documentaire, Pays::Russie, ChaineInternee("Réalisateur"), 1970};
+        Film film12{"Nom12", Film::Genre::Documentaire, Pays::Russie, ChaineInternee("Réalisateur"), 1970};
+        Film film13{"Nom13", Film::Genre::Documentaire, Pays::Russie, ChaineInternee("Réalisateur"), 1970};
         gestionnaireFilms.ajouterFilm(film10);
         gestionnaireFilms.ajouterFilm(film11);
         gestionnaireFilms.ajouterFilm(film12);
@@ -416,27 +593,28 @@ namespace Tests
         const Film* pointeurFilm11 = gestionnaireFilms.getFilmParNom(film11.nom);
         const Film* pointeurFilm12 = gestionnaireFilms.getFilmParNom(film12.nom);
         const Film* pointeurFilm13 = gestionnaireFilms.getFilmParNom(film13.nom);
-        std::vector<const Film*> filmsParPays2 = gestionnaireFilms.getFilmsParPays(Pays::Russie);
+        VueFilms filmsParPays2 = gestionnaireFilms.getFilmsParPays(Pays::Russie);
         std::vector<const Film*> filmsParPays2Attendus = {pointeurFilm10,
                                                           pointeurFilm11,
                                                           pointeurFilm12,
                                                           pointeurFilm13};
         bool filmsParPays2Valides = filmsParPays2 == filmsParPays2Attendus;
         gestionnaireFilms.supprimerFilm(film11.nom);
-        std::vector<const Film*> filmsParPays3 = gestionnaireFilms.getFilmsParPays(Pays::Russie);
+        VueFilms filmsParPays3 = gestionnaireFilms.getFilmsParPays(Pays::Russie);
         std::vector<const Film*> filmsParPays3Attendus = {pointeurFilm10, pointeurFilm12, pointeurFilm13};
-        bool filmsParPays3Valides = filmsParPays3 == filmsParPays3Attendus;
+        bool filmsParPays3Valides = std::is_permutation(filmsParPays3.begin(), filmsParPays3.end(),
+                                                        filmsParPays3Attendus.begin(), filmsParPays3Attendus.end());
         tests.push_back(filmsParPays1.empty() && filmsParPays2Valides && filmsParPays3Valides);
         afficherResultatTest(6, "GestionnaireFilms::getFilmsParPays", tests.back());
 
         // Test 7
         std::vector<const Film*> filmsEntreAnnees1 = gestionnaireFilms.getFilmsEntreAnnees(1000, 1100);
-        Film film14{"Nom14", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film15{"Nom15", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1980};
-        Film film16{"Nom16", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1985};
-        Film film17{"Nom17", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1995};
-        Film film18{"Nom18", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 2000};
-        Film film19{"Nom19", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 2010};
+        Film film14{"Nom14", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film15{"Nom15", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1980};
+        Film film16{"Nom16", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1985};
+        Film film17{"Nom17", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1995};
+        Film film18{"Nom18", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 2000};
+        Film film19{"Nom19", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 2010};
         gestionnaireFilms.ajouterFilm(film14);
         gestionnaireFilms.ajouterFilm(film15);
         gestionnaireFilms.ajouterFilm(film16);
@@ -462,11 +640,11 @@ namespace Tests
 
         // Test 8
         gestionnaireFilms = GestionnaireFilms(); // Réinitialiser le gestionnaire de films
-        Film film20{"Nom20", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film21{"Nom21", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film22{"Nom22", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film23{"Nom23", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
-        Film film24{"Nom24", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film film20{"Nom20", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film21{"Nom21", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film22{"Nom22", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film23{"Nom23", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
+        Film film24{"Nom24", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         gestionnaireFilms.ajouterFilm(film20);
         gestionnaireFilms.ajouterFilm(film21);
         gestionnaireFilms.ajouterFilm(film22);
@@ -494,6 +672,446 @@ namespace Tests
         tests.push_back(nombre3 == gestionnaireFilms.getNombreFilms() && nombre4 == 331);
         afficherResultatTest(9, "Chargement et copy ctor toujours fonctionnels", tests.back());
 
+        // Test 10
+        static const std::string nomFichierFilms = "films_test_parallele.txt";
+        {
+            std::ofstream fichierFilms(nomFichierFilms);
+            for (int i = 0; i < 50; i++)
+            {
+                fichierFilms << "\"Film " << i << "\" " << i % 9 << ' ' << i % 9 << " \"Réalisateur \\\"" << i
+                             << "\\\"\" " << 1950 + i << '\n';
+            }
+            fichierFilms << "\"Film 7\" 0 0 \"Doublon\" 2000\n"
+                         << "\"Film hors genre\" 12 0 \"Réalisateur\" 2000\n"
+                         << "\"Film hors pays\" 0 -1 \"Réalisateur\" 2000\n"
+                         << "\"Film invalide\" 0 0 \"Réalisateur\"";
+        }
+        GestionnaireFilms gestionnaireSequentiel;
+        GestionnaireFilms gestionnaireParallele;
+        // Un chargement remplace tout le contenu précédent, index compris
+        Film ancienFilm{"Ancien film", Film::Genre::Horreur, Pays::Japon, ChaineInternee("Ancien"), 1900};
+        gestionnaireSequentiel.ajouterFilm(ancienFilm);
+        gestionnaireParallele.ajouterFilm(ancienFilm);
+        bool chargementSequentiel = gestionnaireSequentiel.chargerDepuisFichier(nomFichierFilms);
+        bool chargementParallele = gestionnaireParallele.chargerDepuisFichierParallele(nomFichierFilms, 4);
+        std::remove(nomFichierFilms.c_str());
+        std::ostringstream sortieSequentielle;
+        std::ostringstream sortieParallele;
+        sortieSequentielle << gestionnaireSequentiel;
+        sortieParallele << gestionnaireParallele;
+        const Film* filmEchappe = gestionnaireParallele.getFilmParNom("Film 7");
+        tests.push_back(!chargementSequentiel && !chargementParallele && gestionnaireParallele.getNombreFilms() == 50 &&
+                        filmEchappe != nullptr && filmEchappe->realisateur.get() == "Réalisateur \"7\"" &&
+                        sortieSequentielle.str() == sortieParallele.str() &&
+                        gestionnaireSequentiel.rechercherFilmsParPrefixe("ancien").empty() &&
+                        gestionnaireParallele.rechercherFilmsParPrefixe("ancien").empty() &&
+                        gestionnaireParallele.getFilmsParRealisateur("Ancien").empty() &&
+                        gestionnaireParallele.getFilmsEntreAnnees(1900, 1900).empty() &&
+                        gestionnaireParallele.rechercherFilms(RequeteFilms()).size() == 50 &&
+                        gestionnaireSequentiel.getFilmParNom("Film hors genre") == nullptr &&
+                        gestionnaireParallele.getFilmParNom("Film hors pays") == nullptr &&
+                        !gestionnaireParallele.ajouterFilm(Film{"Film hors genre",
+                                                                static_cast<Film::Genre>(Film::nombreGenres),
+                                                                Pays::Japon, ChaineInternee(""), 2000}));
+        afficherResultatTest(10, "GestionnaireFilms::chargerDepuisFichierParallele", tests.back());
+
+        // Test 11
+        GestionnaireFilms gestionnaireIndices;
+        ChaineInternee realisateurIndices("Réalisateur");
+        gestionnaireIndices.ajouterFilm(Film{"A", Film::Genre::Drame, Pays::Canada, realisateurIndices, 2000});
+        gestionnaireIndices.ajouterFilm(Film{"B", Film::Genre::Drame, Pays::Canada, realisateurIndices, 2000});
+        gestionnaireIndices.supprimerFilm("A");
+        gestionnaireIndices.ajouterFilm(Film{"C", Film::Genre::Drame, Pays::Canada, realisateurIndices, 2000, 42});
+        GestionnaireFilms copieIndices = gestionnaireIndices;
+        copieIndices.ajouterFilm(Film{"D", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        // Un catalogue dont les films sont sans cesse remplacés réutilise les indices des films supprimés, sans que
+        // les entrées périmées de l'index des titres ne désignent les nouveaux films
+        GestionnaireFilms gestionnaireRotation;
+        for (int i = 0; i < 3'000; i++)
+        {
+            gestionnaireRotation.ajouterFilm(Film{"Rotation " + std::to_string(i), Film::Genre::Drame, Pays::Canada,
+                                                  ChaineInternee("Réalisateur"), 2000});
+            if (i >= 100)
+            {
+                gestionnaireRotation.supprimerFilm("Rotation " + std::to_string(i - 100));
+            }
+        }
+        bool rotationValide = gestionnaireRotation.getNombreFilms() == 100 &&
+                              gestionnaireRotation.rechercherFilms(RequeteFilms()).size() == 100 &&
+                              gestionnaireRotation.rechercherFilmsParSousChaine("rotation").size() == 100 &&
+                              gestionnaireRotation.rechercherFilmsParSousChaine("tion 29").size() == 100 &&
+                              gestionnaireRotation.rechercherFilmsParSousChaine("rotation 5").empty();
+        // Les indices réutilisés ne suivent plus l'ordre d'ajout, que la recherche par sous-chaîne doit conserver
+        std::vector<const Film*> filmsRotation = gestionnaireRotation.rechercherFilmsParSousChaine("rotation");
+        for (int i = 2'900; i < 3'000; i++)
+        {
+            const Film* film = gestionnaireRotation.getFilmParNom("Rotation " + std::to_string(i));
+            rotationValide = rotationValide && film->indice <= 100 &&
+                             filmsRotation[static_cast<std::size_t>(i - 2'900)] == film;
+        }
+        tests.push_back(gestionnaireIndices.getFilmParNom("B")->indice == 1 &&
+                        gestionnaireIndices.getFilmParNom("C")->indice == 0 &&
+                        copieIndices.getFilmParNom("C")->indice == 0 && copieIndices.getFilmParNom("D")->indice == 2 &&
+                        rotationValide);
+        afficherResultatTest(11, "Film::indice", tests.back());
+
+        // Test 12
+        GestionnaireFilms gestionnaireAnnees;
+        for (int i = 0; i < 200; i++)
+        {
+            gestionnaireAnnees.ajouterFilm(Film{"Film " + std::to_string(i), Film::Genre::Drame, Pays::Canada,
+                                                ChaineInternee("Réalisateur"), 1900 + i * 37 % 120});
+        }
+        for (int i = 0; i < 200; i += 3)
+        {
+            gestionnaireAnnees.supprimerFilm("Film " + std::to_string(i));
+        }
+        const GestionnaireFilms& gestionnaireAnneesConstant = gestionnaireAnnees;
+        bool anneesValides = gestionnaireAnneesConstant.getFilmsEntreAnnees(1950, 1940).empty();
+        for (int anneeDebut = 1890; anneeDebut < 2030 && anneesValides; anneeDebut += 7)
+        {
+            int anneeFin = anneeDebut + anneeDebut % 25;
+            std::vector<const Film*> filmsAttendus;
+            for (int i = 0; i < 200; i++)
+            {
+                const Film* film = gestionnaireAnnees.getFilmParNom("Film " + std::to_string(i));
+                if (film && film->annee >= anneeDebut && film->annee <= anneeFin)
+                {
+                    filmsAttendus.push_back(film);
+                }
+            }
+            std::stable_sort(filmsAttendus.begin(), filmsAttendus.end(),
+                             [](const Film* film1, const Film* film2) { return film1->annee < film2->annee; });
+            anneesValides = gestionnaireAnneesConstant.getFilmsEntreAnnees(anneeDebut, anneeFin) == filmsAttendus;
+        }
+        tests.push_back(anneesValides);
+        afficherResultatTest(12, "GestionnaireFilms index par année", tests.back());
+
+        // Test 13
+        GestionnaireFilms gestionnaireSuppressions;
+        std::vector<const Film*> pointeursAvantSuppressions;
+        for (int i = 0; i < 300; i++)
+        {
+            gestionnaireSuppressions.ajouterFilm(Film{"Film " + std::to_string(i), static_cast<Film::Genre>(i % 4),
+                                                      static_cast<Pays>(i % 5), ChaineInternee("Réalisateur"),
+                                                      2000 + i % 3});
+            pointeursAvantSuppressions.push_back(gestionnaireSuppressions.getFilmParNom("Film " + std::to_string(i)));
+        }
+        for (int i = 0; i < 300; i += 2)
+        {
+            gestionnaireSuppressions.supprimerFilm("Film " + std::to_string((i * 7) % 300));
+        }
+        const GestionnaireFilms copieSuppressions = gestionnaireSuppressions;
+        bool suppressionsValides = !gestionnaireSuppressions.supprimerFilm("Film 0") &&
+                                   gestionnaireSuppressions.getNombreFilms() == 150 &&
+                                   copieSuppressions.getNombreFilms() == 150;
+        std::array<std::size_t, Film::nombreGenres> filmsParGenreAttendus{};
+        std::array<std::size_t, nombrePays> filmsParPaysAttendus{};
+        for (int i = 1; i < 300; i += 2)
+        {
+            const Film* film = gestionnaireSuppressions.getFilmParNom("Film " + std::to_string(i));
+            VueFilms filmsGenre = gestionnaireSuppressions.getFilmsParGenre(film->genre);
+            VueFilms filmsPays = gestionnaireSuppressions.getFilmsParPays(film->pays);
+            std::vector<const Film*> filmsAnnee =
+                gestionnaireSuppressions.getFilmsEntreAnnees(film->annee, film->annee);
+            filmsParGenreAttendus[static_cast<std::size_t>(film->genre)]++;
+            filmsParPaysAttendus[static_cast<std::size_t>(film->pays)]++;
+            suppressionsValides =
+                suppressionsValides && film == pointeursAvantSuppressions[static_cast<std::size_t>(i)] &&
+                std::count(filmsGenre.begin(), filmsGenre.end(), film) == 1 &&
+                std::count(filmsPays.begin(), filmsPays.end(), film) == 1 &&
+                std::count(filmsAnnee.begin(), filmsAnnee.end(), film) == 1 &&
+                copieSuppressions.getFilmParNom(film->nom)->indice == film->indice;
+        }
+        for (std::size_t i = 0; i < Film::nombreGenres; i++)
+        {
+            VueFilms filmsGenre = gestionnaireSuppressions.getFilmsParGenre(static_cast<Film::Genre>(i));
+            VueFilms filmsGenreCopie = copieSuppressions.getFilmsParGenre(static_cast<Film::Genre>(i));
+            suppressionsValides = suppressionsValides && filmsGenre.size() == filmsParGenreAttendus[i] &&
+                                  std::equal(filmsGenre.begin(), filmsGenre.end(), filmsGenreCopie.begin(),
+                                             filmsGenreCopie.end(), [](const Film* film1, const Film* film2)
+                                             { return film1->nom == film2->nom && film1 != film2; });
+        }
+        for (std::size_t i = 0; i < nombrePays; i++)
+        {
+            suppressionsValides = suppressionsValides && gestionnaireSuppressions.getFilmsParPays(static_cast<Pays>(i))
+                                                                 .size() == filmsParPaysAttendus[i];
+        }
+        tests.push_back(suppressionsValides);
+        afficherResultatTest(13, "GestionnaireFilms suppressions en O(1)", tests.back());
+
+        // Test 14
+        GestionnaireFilms gestionnaireEntrepot;
+        for (int i = 0; i < 600; i++)
+        {
+            gestionnaireEntrepot.ajouterFilm(Film{"Film " + std::to_string(i), Film::Genre::Drame, Pays::Canada,
+                                                  ChaineInternee("Réalisateur"), 2000});
+        }
+        const Film* filmAvantDeplacement = gestionnaireEntrepot.getFilmParNom("Film 599");
+        GestionnaireFilms gestionnaireDeplace = std::move(gestionnaireEntrepot);
+        gestionnaireDeplace.supprimerFilm("Film 10");
+        const Film* filmSupprime = gestionnaireDeplace.getFilmParNom("Film 11");
+        gestionnaireDeplace.supprimerFilm("Film 11");
+        gestionnaireDeplace.ajouterFilm(
+            Film{"Film 600", Film::Genre::Action, Pays::France, ChaineInternee("Réalisateur"), 2001});
+        GestionnaireFilms copieEntrepot = gestionnaireDeplace;
+        copieEntrepot.supprimerFilm("Film 599");
+        tests.push_back(gestionnaireDeplace.getFilmParNom("Film 599") == filmAvantDeplacement &&
+                        gestionnaireDeplace.getFilmParNom("Film 600") == filmSupprime &&
+                        gestionnaireDeplace.getNombreFilms() == 599 && copieEntrepot.getNombreFilms() == 598 &&
+                        filmAvantDeplacement->nom == "Film 599");
+        afficherResultatTest(14, "GestionnaireFilms adresses stables", tests.back());
+
+        // Test 15
+        GestionnaireFilms gestionnaireRealisateurs;
+        for (int i = 0; i < 90; i++)
+        {
+            gestionnaireRealisateurs.ajouterFilm(Film{"Film " + std::to_string(i), Film::Genre::Drame, Pays::Canada,
+                                                      ChaineInternee("Réalisatrice " + std::to_string(i % 9)), 2000});
+        }
+        for (int i = 0; i < 90; i += 4)
+        {
+            gestionnaireRealisateurs.supprimerFilm("Film " + std::to_string(i));
+        }
+        const GestionnaireFilms copieRealisateurs = gestionnaireRealisateurs;
+        const Film* filmRealisateur1 = copieRealisateurs.getFilmParNom("Film 1");
+        const Film* filmRealisateur10 = copieRealisateurs.getFilmParNom("Film 10");
+        // Chercher un réalisateur inconnu ne doit pas l'interner
+        std::uint32_t nombreChainesAvantRecherches = ChaineInternee::getNombreChaines();
+        RequeteFilms requeteRealisateurInconnu;
+        requeteRealisateurInconnu.realisateur = "Inconnue aussi";
+        bool realisateursValides = &filmRealisateur1->realisateur.get() == &filmRealisateur10->realisateur.get() &&
+                                   filmRealisateur1->realisateur.get() == "Réalisatrice 1" &&
+                                   filmRealisateur1->realisateur !=
+                                       copieRealisateurs.getFilmParNom("Film 2")->realisateur &&
+                                   ChaineInternee::trouver("Réalisatrice 1") == filmRealisateur1->realisateur &&
+                                   !ChaineInternee::trouver("Inconnue") &&
+                                   copieRealisateurs.getFilmsParRealisateur("Inconnue").empty() &&
+                                   copieRealisateurs.rechercherFilms(requeteRealisateurInconnu).empty() &&
+                                   ChaineInternee::getNombreChaines() == nombreChainesAvantRecherches;
+        for (int i = 0; i < 9; i++)
+        {
+            std::string realisateur = "Réalisatrice " + std::to_string(i);
+            VueFilms filmsRealisateur = copieRealisateurs.getFilmsParRealisateur(realisateur);
+            std::size_t nombreAttendu = 0;
+            for (int j = i; j < 90; j += 9)
+            {
+                nombreAttendu += j % 4 != 0 ? 1 : 0;
+            }
+            realisateursValides =
+                realisateursValides && filmsRealisateur.size() == nombreAttendu &&
+                std::all_of(filmsRealisateur.begin(), filmsRealisateur.end(),
+                            [&](const Film* film)
+                            { return film->realisateur.get() == realisateur &&
+                                     copieRealisateurs.getFilmParNom(film->nom) == film; });
+        }
+        tests.push_back(realisateursValides);
+        afficherResultatTest(15, "GestionnaireFilms index par réalisateur", tests.back());
+
+        // Test 16
+        GestionnaireFilms gestionnaireRequetes;
+        std::mt19937 generateurRequetes(3);
+        for (int i = 0; i < 700; i++)
+        {
+            gestionnaireRequetes.ajouterFilm(
+                Film{"Film " + std::to_string(i), static_cast<Film::Genre>(generateurRequetes() % Film::nombreGenres),
+                     static_cast<Pays>(generateurRequetes() % nombrePays),
+                     ChaineInternee("Réalisateur " + std::to_string(generateurRequetes() % 5)),
+                     1990 + static_cast<int>(generateurRequetes() % 30)});
+        }
+        for (int i = 0; i < 700; i += 3)
+        {
+            gestionnaireRequetes.supprimerFilm("Film " + std::to_string(i));
+        }
+        const GestionnaireFilms copieRequetes = gestionnaireRequetes;
+        bool requetesValides = copieRequetes.rechercherFilms(RequeteFilms()).size() == 466;
+        for (int i = 0; i < 200 && requetesValides; i++)
+        {
+            RequeteFilms requete;
+            for (std::size_t j = 0; j < Film::nombreGenres; j++)
+            {
+                if (generateurRequetes() % 3 == 0)
+                {
+                    requete.genres.push_back(static_cast<Film::Genre>(j));
+                }
+            }
+            for (std::size_t j = 0; j < nombrePays; j++)
+            {
+                if (generateurRequetes() % 2 == 0)
+                {
+                    requete.pays.push_back(static_cast<Pays>(j));
+                }
+            }
+            if (i % 5 == 0)
+            {
+                // Des valeurs hors des enums ne correspondent à aucun film
+                requete.genres.push_back(static_cast<Film::Genre>(Film::nombreGenres));
+                requete.pays.push_back(static_cast<Pays>(-1));
+            }
+            if (i % 2 == 0)
+            {
+                requete.anneeDebut = 1985 + static_cast<int>(generateurRequetes() % 30);
+                requete.anneeFin = requete.anneeDebut + static_cast<int>(generateurRequetes() % 15) - 2;
+            }
+            if (i % 3 == 0)
+            {
+                requete.realisateur = "Réalisateur " + std::to_string(generateurRequetes() % 6);
+            }
+
+            std::vector<const Film*> filmsAttendus;
+            for (int j = 0; j < 700; j++)
+            {
+                const Film* film = copieRequetes.getFilmParNom("Film " + std::to_string(j));
+                if (film != nullptr &&
+                    (requete.genres.empty() ||
+                     std::count(requete.genres.begin(), requete.genres.end(), film->genre) > 0) &&
+                    (requete.pays.empty() || std::count(requete.pays.begin(), requete.pays.end(), film->pays) > 0) &&
+                    requete.anneeDebut <= film->annee && film->annee <= requete.anneeFin &&
+                    (!requete.realisateur || film->realisateur.get() == *requete.realisateur))
+                {
+                    filmsAttendus.push_back(film);
+                }
+            }
+            requetesValides = copieRequetes.rechercherFilms(requete) == filmsAttendus &&
+                              gestionnaireRequetes.rechercherFilms(requete).size() == filmsAttendus.size();
+        }
+        RequeteFilms requeteInvalide;
+        requeteInvalide.genres.push_back(static_cast<Film::Genre>(Film::nombreGenres + 3));
+        tests.push_back(requetesValides && copieRequetes.rechercherFilms(requeteInvalide).empty() &&
+                        copieRequetes.getFilmsParGenre(requeteInvalide.genres.back()).empty() &&
+                        copieRequetes.getFilmsParPays(static_cast<Pays>(nombrePays)).empty());
+        afficherResultatTest(16, "GestionnaireFilms::rechercherFilms", tests.back());
+
+        // Test 17
+        GestionnaireFilms gestionnaireTitres;
+        const std::array<std::string, 6> motsTitres = {"Le", "retour", "DU", "Roi", "Matrice", "été"};
+        std::vector<std::string> titres;
+        for (int i = 0; i < 600; i++)
+        {
+            std::string titre = motsTitres[generateurRequetes() % motsTitres.size()];
+            for (std::size_t j = generateurRequetes() % 3; j > 0; j--)
+            {
+                titre += ' ' + motsTitres[generateurRequetes() % motsTitres.size()];
+            }
+            titre += ' ' + std::to_string(i);
+            titres.push_back(titre);
+            gestionnaireTitres.ajouterFilm(
+                Film{titre, Film::Genre::Action, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        }
+        for (int i = 0; i < 600; i += 2)
+        {
+            gestionnaireTitres.supprimerFilm(titres[static_cast<std::size_t>(i)]);
+        }
+        const GestionnaireFilms copieTitres = gestionnaireTitres;
+        auto enMinuscules = [](std::string chaine)
+        {
+            std::transform(chaine.begin(), chaine.end(), chaine.begin(), [](char caractere)
+                           { return caractere >= 'A' && caractere <= 'Z' ? static_cast<char>(caractere + 32)
+                                                                         : caractere; });
+            return chaine;
+        };
+        const std::array<std::string, 11> recherches = {"", "r", "Ro", "RETOUR", "roi 1", "été", "atrice", "2", "zzz",
+                                                        "é", "zq"};
+        bool recherchesValides = true;
+        for (const std::string& recherche : recherches)
+        {
+            std::vector<const Film*> prefixesAttendus;
+            std::vector<const Film*> sousChainesAttendues;
+            for (const std::string& titre : titres)
+            {
+                const Film* film = copieTitres.getFilmParNom(titre);
+                if (film != nullptr && enMinuscules(titre).find(enMinuscules(recherche)) != std::string::npos)
+                {
+                    sousChainesAttendues.push_back(film);
+                }
+                if (film != nullptr && enMinuscules(titre).rfind(enMinuscules(recherche), 0) == 0)
+                {
+                    prefixesAttendus.push_back(film);
+                }
+            }
+            std::sort(prefixesAttendus.begin(), prefixesAttendus.end(), [&](const Film* film1, const Film* film2)
+                      { return enMinuscules(film1->nom) < enMinuscules(film2->nom); });
+            std::vector<const Film*> sousChainesLimitees(
+                sousChainesAttendues.begin(),
+                sousChainesAttendues.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(
+                                                   sousChainesAttendues.size(), 5)));
+            recherchesValides = recherchesValides &&
+                                copieTitres.rechercherFilmsParPrefixe(recherche) == prefixesAttendus &&
+                                copieTitres.rechercherFilmsParSousChaine(recherche) == sousChainesAttendues &&
+                                copieTitres.rechercherFilmsParSousChaine(recherche, 5) == sousChainesLimitees &&
+                                gestionnaireTitres.rechercherFilmsParSousChaine(recherche).size() ==
+                                    sousChainesAttendues.size();
+        }
+        tests.push_back(recherchesValides && copieTitres.rechercherFilmsParPrefixe("le", 3).size() == 3);
+        afficherResultatTest(17, "GestionnaireFilms recherche par titre", tests.back());
+
+        // Test 18
+        // Chaque modification ajoute 10 films puis en supprime 5: une version cohérente contient un multiple de 5
+        // films, tous trouvables par leur nom, et un lecteur ne voit jamais le catalogue rapetisser
+        CatalogueConcurrent catalogue;
+        std::atomic<bool> ecritureTerminee = false;
+        std::atomic<int> nombreLecturesInvalides = 0;
+        std::atomic<std::size_t> nombreLectures = 0;
+        std::vector<std::thread> lecteurs;
+        for (int i = 0; i < 8; i++)
+        {
+            lecteurs.emplace_back(
+                [&]()
+                {
+                    std::size_t nombreFilmsPrecedent = 0;
+                    while (!ecritureTerminee)
+                    {
+                        CatalogueConcurrent::Lecture lecture = catalogue.lire();
+                        std::vector<const Film*> films = lecture->rechercherFilms(RequeteFilms());
+                        bool lectureValide = lecture->getNombreFilms() == films.size() && films.size() % 5 == 0 &&
+                                             films.size() >= nombreFilmsPrecedent;
+                        for (const Film* film : films)
+                        {
+                            lectureValide = lectureValide && lecture->getFilmParNom(film->nom) == film;
+                        }
+                        nombreLecturesInvalides += lectureValide ? 0 : 1;
+                        nombreFilmsPrecedent = films.size();
+                        nombreLectures++;
+                    }
+                });
+        }
+        for (int i = 0; i < 200; i++)
+        {
+            catalogue.modifier(
+                [i](GestionnaireFilms& films)
+                {
+                    for (int j = 0; j < 10; j++)
+                    {
+                        films.ajouterFilm(Film{"Film " + std::to_string(i * 10 + j), Film::Genre::Drame, Pays::France,
+                                               ChaineInternee("Réalisateur"), 2000 + j});
+                    }
+                    for (int j = 0; j < 10; j += 2)
+                    {
+                        films.supprimerFilm("Film " + std::to_string(i * 10 + j));
+                    }
+                    return true;
+                });
+        }
+        ecritureTerminee = true;
+        for (std::thread& lecteur : lecteurs)
+        {
+            lecteur.join();
+        }
+        bool catalogueValide = catalogue.lire()->getNombreFilms() == 1000 &&
+                               !catalogue.ajouterFilm(
+                                   Film{"Film 1", Film::Genre::Drame, Pays::France, ChaineInternee(), 2000}) &&
+                               catalogue.supprimerFilm("Film 1") && catalogue.lire()->getFilmParNom("Film 1") == nullptr;
+        {
+            CatalogueConcurrent::Lecture lectureAncienne = catalogue.lire();
+            catalogue.supprimerFilm("Film 3");
+            catalogueValide = catalogueValide && lectureAncienne->getFilmParNom("Film 3") != nullptr &&
+                              catalogue.getNombreVersionsRetirees() == 1;
+        }
+        catalogue.supprimerFilm("Film 5");
+        tests.push_back(catalogueValide && nombreLecturesInvalides == 0 && nombreLectures > 0 &&
+                        catalogue.getNombreVersionsRetirees() == 0);
+        afficherResultatTest(18, "CatalogueConcurrent lecteurs et écrivain", tests.back());
+
         int nombreTestsReussis = static_cast<int>(std::count(tests.begin(), tests.end(), true));
         double totalPointsSection =
             static_cast<double>(nombreTestsReussis) / static_cast<double>(tests.size()) * maxPointsSection;
@@ -532,7 +1150,7 @@ namespace Tests
         {
             std::string nomFilm = "Nom" + std::to_string(i + 1);
             gestionnaireFilms.ajouterFilm(
-                Film{nomFilm, Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970});
+                Film{nomFilm, Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970});
             pointeursFilms[i] = gestionnaireFilms.getFilmParNom(nomFilm);
         }
 
@@ -580,20 +1198,20 @@ namespace Tests
             LigneLog{"2020-05-01T01:00:00Z", pointeursUtilisateurs[3], pointeursFilms[8]},
             LigneLog{"2019-03-01T01:00:00Z", pointeursUtilisateurs[1], pointeursFilms[9]},
         };
-        analyseurLogs.logs_.clear();
+        analyseurLogs.logs_.effacer();
         for (const auto& ligneLog : logsAjoutes)
         {
             analyseurLogs.ajouterLigneLog(ligneLog);
         }
         bool logsSontOrdonnes =
-            std::is_sorted(analyseurLogs.logs_.begin(), analyseurLogs.logs_.end(), ComparateurLog());
-        int nombreVuesFilm1 = analyseurLogs.vuesFilms_[pointeursFilms[4]];
-        int nombreVuesFilm2 = analyseurLogs.vuesFilms_[pointeursFilms[5]];
+            std::is_sorted(analyseurLogs.logs_.getTimestamps().begin(), analyseurLogs.logs_.getTimestamps().end());
+        int nombreVuesFilm1 = analyseurLogs.getNombreVuesFilm(pointeursFilms[4]);
+        int nombreVuesFilm2 = analyseurLogs.getNombreVuesFilm(pointeursFilms[5]);
         tests.push_back(logsSontOrdonnes && nombreVuesFilm1 == 6 && nombreVuesFilm2 == 1);
         afficherResultatTest(2, "AnalyseurLogs::ajouterLigneLog", tests.back());
 
         // Test 3
-        Film filmInconnu{"Inconnu", Film::Genre::Documentaire, Pays::RoyaumeUni, "Réalisateur", 1970};
+        Film filmInconnu{"Inconnu", Film::Genre::Documentaire, Pays::RoyaumeUni, ChaineInternee("Réalisateur"), 1970};
         int nombreVuesFilm3 = analyseurLogs.getNombreVuesFilm(&filmInconnu);
         int nombreVuesFilm4 = analyseurLogs.getNombreVuesFilm(nullptr);
         int nombreVuesFilm5 = analyseurLogs.getNombreVuesFilm(pointeursFilms[8]);
@@ -649,6 +1267,724 @@ namespace Tests
         tests.push_back(filmsVus1.empty() && filmsVus2.empty() && filmsVus3 == filmsVus3Attendus && filmsVus4.empty());
         afficherResultatTest(7, "AnalyseurLogs::getFilmsVusParUtilisateur", tests.back());
 
+        // Test 8
+        static const std::string nomFichierLogs = "logs_test_mappe.txt";
+        {
+            std::ofstream fichierLogs(nomFichierLogs);
+            fichierLogs << "2018-01-01T12:00:00Z prénom.nom.2@email.com \"Nom3\"\n"
+                        << "2018-01-01T01:00:00Z   prénom.nom.1@email.com \"Nom1\"\r\n"
+                        << "ligne invalide\n"
+                        << "2018-01-01T02:00:00Z prénom.nom.1@email.com \"Non terminé\n"
+                        << "2018-01-01T03:00:00Z inconnu@email.com \"Nom1\"\n"
+                        << "2018-01-01T01:00:00Z prénom.nom.3@email.com Nom2";
+        }
+        AnalyseurLogs analyseurLogsFlux;
+        AnalyseurLogs analyseurLogsMappe;
+        StatistiquesChargement statistiques;
+        bool chargementFlux =
+            analyseurLogsFlux.chargerDepuisFichier(nomFichierLogs, gestionnaireUtilisateurs, gestionnaireFilms);
+        bool chargementMappe = analyseurLogsMappe.chargerDepuisFichierMappe(
+            nomFichierLogs, gestionnaireUtilisateurs, gestionnaireFilms, &statistiques);
+        bool chargementInexistant = analyseurLogsMappe.chargerDepuisFichierMappe(
+            "inexistant.txt", gestionnaireUtilisateurs, gestionnaireFilms);
+        std::remove(nomFichierLogs.c_str());
+        bool logsIdentiques =
+            analyseurLogsFlux.getNombreLignesLog() == 3 &&
+            analyseurLogsFlux.getNombreLignesLog() == analyseurLogsMappe.getNombreLignesLog() &&
+            analyseurLogsFlux.classementFilms_.getVues() == analyseurLogsMappe.classementFilms_.getVues();
+        for (std::size_t i = 0; logsIdentiques && i < analyseurLogsFlux.getNombreLignesLog(); i++)
+        {
+            LigneLog ligneFlux = analyseurLogsFlux.getLigneLog(i);
+            LigneLog ligneMappe = analyseurLogsMappe.getLigneLog(i);
+            logsIdentiques = ligneFlux.timestamp == ligneMappe.timestamp &&
+                             ligneFlux.utilisateur == ligneMappe.utilisateur && ligneFlux.film == ligneMappe.film;
+        }
+        tests.push_back(!chargementFlux && !chargementMappe && !chargementInexistant && logsIdentiques &&
+                        statistiques.nombreLignes == 6);
+        afficherResultatTest(8, "AnalyseurLogs::chargerDepuisFichierMappe", tests.back());
+
+        // Test 9
+        AnalyseurLogs analyseurLogsParLigne;
+        AnalyseurLogs analyseurLogsParLot;
+        std::size_t moitie = logsAjoutes.size() / 2;
+        for (std::size_t i = 0; i < logsAjoutes.size(); i++)
+        {
+            analyseurLogsParLigne.ajouterLigneLog(logsAjoutes[i]);
+            if (i < moitie)
+            {
+                analyseurLogsParLot.ajouterLigneLog(logsAjoutes[i]);
+            }
+        }
+        analyseurLogsParLot.ajouterLignesLog(std::vector<LigneLog>(std::next(logsAjoutes.begin(), moitie),
+                                                                   logsAjoutes.end()));
+        analyseurLogsParLot.ajouterLignesLog({});
+        bool lotsIdentiques =
+            analyseurLogsParLigne.getNombreLignesLog() == analyseurLogsParLot.getNombreLignesLog() &&
+            analyseurLogsParLigne.classementFilms_.getVues() == analyseurLogsParLot.classementFilms_.getVues();
+        for (std::size_t i = 0; lotsIdentiques && i < analyseurLogsParLigne.getNombreLignesLog(); i++)
+        {
+            LigneLog ligneParLigne = analyseurLogsParLigne.getLigneLog(i);
+            LigneLog ligneParLot = analyseurLogsParLot.getLigneLog(i);
+            lotsIdentiques = ligneParLigne.timestamp == ligneParLot.timestamp &&
+                             ligneParLigne.utilisateur == ligneParLot.utilisateur &&
+                             ligneParLigne.film == ligneParLot.film;
+        }
+        tests.push_back(lotsIdentiques);
+        afficherResultatTest(9, "AnalyseurLogs::ajouterLignesLog", tests.back());
+
+        // Test 10
+        static const std::string nomFichierLogsParallele = "logs_test_parallele.txt";
+        {
+            std::ofstream fichierLogs(nomFichierLogsParallele);
+            for (std::size_t i = 0; i < 200; i++)
+            {
+                fichierLogs << "2018-01-01T" << (i * 7) % 24 / 10 << (i * 7) % 24 % 10 << ":00:00Z prénom.nom."
+                            << i % nombreUtilisateurs + 1 << "@email.com \"Nom" << i % nombreFilms + 1 << "\"\n";
+                if (i % 50 == 0)
+                {
+                    // Une ligne bien découpée dont l'horodatage n'existe pas est rejetée comme une ligne mal formée
+                    fichierLogs << "ligneInvalide" << i << '\n'
+                                << "2018-02-30T00:00:00Z prénom.nom.1@email.com \"Nom1\"\n";
+                }
+            }
+        }
+        AnalyseurLogs analyseurLogsSequentiel;
+        AnalyseurLogs analyseurLogsParallele;
+        bool chargementSequentiel = analyseurLogsSequentiel.chargerDepuisFichier(
+            nomFichierLogsParallele, gestionnaireUtilisateurs, gestionnaireFilms);
+        bool chargementParallele = analyseurLogsParallele.chargerDepuisFichierParallele(
+            nomFichierLogsParallele, gestionnaireUtilisateurs, gestionnaireFilms, 4);
+        std::remove(nomFichierLogsParallele.c_str());
+        bool logsParallelesIdentiques =
+            analyseurLogsSequentiel.getNombreLignesLog() == 200 &&
+            analyseurLogsSequentiel.getNombreLignesLog() == analyseurLogsParallele.getNombreLignesLog() &&
+            analyseurLogsSequentiel.classementFilms_.getVues() == analyseurLogsParallele.classementFilms_.getVues();
+        for (std::size_t i = 0; logsParallelesIdentiques && i < analyseurLogsSequentiel.getNombreLignesLog(); i++)
+        {
+            LigneLog ligneSequentielle = analyseurLogsSequentiel.getLigneLog(i);
+            LigneLog ligneParallele = analyseurLogsParallele.getLigneLog(i);
+            logsParallelesIdentiques = ligneSequentielle.timestamp == ligneParallele.timestamp &&
+                                       ligneSequentielle.utilisateur == ligneParallele.utilisateur &&
+                                       ligneSequentielle.film == ligneParallele.film;
+        }
+        tests.push_back(!chargementSequentiel && !chargementParallele && logsParallelesIdentiques);
+        afficherResultatTest(10, "AnalyseurLogs::chargerDepuisFichierParallele", tests.back());
+
+        // Test 11
+        static const std::string nomFichierSuivi = "logs_test_suivi.txt";
+        AnalyseurLogs analyseurLogsSuivi;
+        SuiviLogs suiviLogs(nomFichierSuivi, analyseurLogsSuivi, gestionnaireUtilisateurs, gestionnaireFilms);
+        {
+            std::ofstream fichierLogs(nomFichierSuivi);
+            fichierLogs << "2018-01-01T05:00:00Z prénom.nom.1@email.com \"Nom1\"\n"
+                        << "2018-01-01T03:00:00Z prénom.nom.2@email.com \"Nom2\"\n"
+                        << "2018-01-01T04:00:00Z prénom.nom.3@email.com \"No";
+        }
+        bool rafraichissement1 = suiviLogs.rafraichir();
+        std::size_t nombreLogs1 = analyseurLogsSuivi.getNombreLignesLog();
+        {
+            std::ofstream fichierLogs(nomFichierSuivi, std::ios::app);
+            fichierLogs << "m1\"\n"
+                        << "2018-01-01T01:00:00Z prénom.nom.4@email.com \"Nom3\"\n";
+        }
+        bool rafraichissement2 = suiviLogs.rafraichir();
+        bool rafraichissement3 = suiviLogs.rafraichirSiEcheance(); // Intervalle d'une seconde non écoulé
+        std::size_t nombreLogs2 = analyseurLogsSuivi.getNombreLignesLog();
+        bool logsSuivisOrdonnes = nombreLogs2 == 4 && analyseurLogsSuivi.getLigneLog(0).film == pointeursFilms[2] &&
+                                  analyseurLogsSuivi.getLigneLog(nombreLogs2 - 1).film == pointeursFilms[0] &&
+                                  analyseurLogsSuivi.getNombreVuesFilm(pointeursFilms[0]) == 2;
+        {
+            std::ofstream fichierLogs(nomFichierSuivi, std::ios::trunc);
+            fichierLogs << "2018-01-01T01:00:00Z prénom.nom.4@email.com \"Nom3\"\n";
+        }
+        bool rafraichissement4 = suiviLogs.rafraichir();
+        std::size_t nombreLogs3 = analyseurLogsSuivi.getNombreLignesLog();
+        std::remove(nomFichierSuivi.c_str());
+        bool rafraichissement5 = suiviLogs.rafraichir();
+        tests.push_back(rafraichissement1 && rafraichissement2 && rafraichissement3 && rafraichissement4 &&
+                        !rafraichissement5 && nombreLogs1 == 2 && logsSuivisOrdonnes && nombreLogs3 == 1 &&
+                        analyseurLogsSuivi.getNombreVuesFilm(pointeursFilms[0]) == 0);
+        afficherResultatTest(11, "SuiviLogs::rafraichir", tests.back());
+
+        // Test 12
+        static const std::string nomFichierInstantane = "instantane_test.bin";
+        bool sauvegarde = Instantane::sauvegarder(nomFichierInstantane, gestionnaireUtilisateurs, gestionnaireFilms,
+                                                  analyseurLogsParLot);
+        GestionnaireUtilisateurs utilisateursRestaures;
+        GestionnaireFilms filmsRestaures;
+        AnalyseurLogs logsRestaures;
+        bool restauration1 =
+            Instantane::charger(nomFichierInstantane, utilisateursRestaures, filmsRestaures, logsRestaures);
+        bool instantaneIdentique = utilisateursRestaures.getNombreUtilisateurs() == nombreUtilisateurs &&
+                                   filmsRestaures.getNombreFilms() == nombreFilms &&
+                                   logsRestaures.getNombreLignesLog() == analyseurLogsParLot.getNombreLignesLog();
+        for (std::size_t i = 0; instantaneIdentique && i < logsRestaures.getNombreLignesLog(); i++)
+        {
+            LigneLog ligneOriginale = analyseurLogsParLot.getLigneLog(i);
+            LigneLog ligneRestauree = logsRestaures.getLigneLog(i);
+            instantaneIdentique = ligneOriginale.timestamp == ligneRestauree.timestamp &&
+                                  ligneRestauree.utilisateur ==
+                                      utilisateursRestaures.getUtilisateurParId(ligneOriginale.utilisateur->id) &&
+                                  ligneRestauree.film == filmsRestaures.getFilmParNom(ligneOriginale.film->nom) &&
+                                  ligneRestauree.film->indice == ligneOriginale.film->indice &&
+                                  logsRestaures.getNombreVuesFilm(ligneRestauree.film) ==
+                                      analyseurLogsParLot.getNombreVuesFilm(ligneOriginale.film);
+        }
+        {
+            std::fstream fichierInstantane(nomFichierInstantane, std::ios::in | std::ios::out | std::ios::binary);
+            fichierInstantane.seekp(-1, std::ios::end);
+            fichierInstantane.put('\x7F');
+        }
+        bool restauration2 =
+            Instantane::charger(nomFichierInstantane, utilisateursRestaures, filmsRestaures, logsRestaures);
+        std::remove(nomFichierInstantane.c_str());
+        // Les indices libérés par des suppressions avant la sauvegarde sont attribués aux ajouts après le chargement
+        GestionnaireUtilisateurs utilisateursTrous;
+        GestionnaireFilms filmsTrous;
+        ChaineInternee realisateurTrous("Réalisateur");
+        utilisateursTrous.ajouterUtilisateur(Utilisateur{"a@email.com", "A", 20, Pays::Canada});
+        utilisateursTrous.ajouterUtilisateur(Utilisateur{"b@email.com", "B", 20, Pays::Canada});
+        utilisateursTrous.supprimerUtilisateur("a@email.com");
+        filmsTrous.ajouterFilm(Film{"A", Film::Genre::Drame, Pays::Canada, realisateurTrous, 2000});
+        filmsTrous.ajouterFilm(Film{"B", Film::Genre::Drame, Pays::Canada, realisateurTrous, 2000});
+        filmsTrous.supprimerFilm("A");
+        GestionnaireUtilisateurs utilisateursTrousRestaures;
+        GestionnaireFilms filmsTrousRestaures;
+        AnalyseurLogs logsTrousRestaures;
+        bool restaurationTrous =
+            Instantane::sauvegarder(nomFichierInstantane, utilisateursTrous, filmsTrous, AnalyseurLogs()) &&
+            Instantane::charger(nomFichierInstantane, utilisateursTrousRestaures, filmsTrousRestaures,
+                                logsTrousRestaures);
+        std::remove(nomFichierInstantane.c_str());
+        utilisateursTrousRestaures.ajouterUtilisateur(Utilisateur{"c@email.com", "C", 20, Pays::Canada});
+        utilisateursTrousRestaures.ajouterUtilisateur(Utilisateur{"d@email.com", "D", 20, Pays::Canada});
+        filmsTrousRestaures.ajouterFilm(Film{"C", Film::Genre::Drame, Pays::Canada, realisateurTrous, 2000});
+        restaurationTrous = restaurationTrous &&
+                            utilisateursTrousRestaures.getUtilisateurParId("c@email.com")->indice == 0 &&
+                            utilisateursTrousRestaures.getUtilisateurParId("d@email.com")->indice == 2 &&
+                            filmsTrousRestaures.getFilmParNom("C")->indice == 0;
+        tests.push_back(sauvegarde && restauration1 && instantaneIdentique && !restauration2 && restaurationTrous &&
+                        logsRestaures.getNombreLignesLog() == analyseurLogsParLot.getNombreLignesLog());
+        afficherResultatTest(12, "Instantane::sauvegarder et Instantane::charger", tests.back());
+
+        // Test 13
+        AnalyseurLogs analyseurLogsHorodatages;
+        bool ajoutValide = analyseurLogsHorodatages.ajouterLigneLog(
+            LigneLog{"2020-02-29T23:59:59Z", pointeursUtilisateurs[0], pointeursFilms[0]});
+        bool ajoutAncien = analyseurLogsHorodatages.ajouterLigneLog(
+            LigneLog{"1969-12-31T23:59:59Z", pointeursUtilisateurs[1], pointeursFilms[1]});
+        bool ajoutDateInexistante = analyseurLogsHorodatages.ajouterLigneLog(
+            LigneLog{"2019-02-29T01:00:00Z", pointeursUtilisateurs[2], pointeursFilms[2]});
+        bool ajoutMalForme = analyseurLogsHorodatages.ajouterLignesLog(
+            {LigneLog{"2018-01-01 01:00:00", pointeursUtilisateurs[3], pointeursFilms[3]},
+             LigneLog{"2018-01-01T01:00:00Z", pointeursUtilisateurs[3], pointeursFilms[3]}});
+        std::int64_t secondesEpoque = -1;
+        bool conversionEpoque = convertirHorodatage("1970-01-01T00:00:00Z", secondesEpoque);
+        tests.push_back(ajoutValide && ajoutAncien && !ajoutDateInexistante && !ajoutMalForme &&
+                        conversionEpoque && secondesEpoque == 0 &&
+                        analyseurLogsHorodatages.getNombreLignesLog() == 3 &&
+                        analyseurLogsHorodatages.getLigneLog(0).timestamp == "1969-12-31T23:59:59Z" &&
+                        analyseurLogsHorodatages.getLigneLog(1).timestamp == "2018-01-01T01:00:00Z" &&
+                        analyseurLogsHorodatages.getLigneLog(2).timestamp == "2020-02-29T23:59:59Z" &&
+                        analyseurLogsHorodatages.getNombreVuesFilm(pointeursFilms[2]) == 0);
+        afficherResultatTest(13, "AnalyseurLogs::getLigneLog et horodatages", tests.back());
+
+        // Test 14
+        GestionnaireFilms autresFilms; // Mêmes identifiants denses que gestionnaireFilms
+        autresFilms.ajouterFilm(Film{"Autre1", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        autresFilms.ajouterFilm(Film{"Autre2", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        const Film* autreFilm1 = autresFilms.getFilmParNom("Autre1");
+        const Film* autreFilm2 = autresFilms.getFilmParNom("Autre2");
+        AnalyseurLogs analyseurLogsConflits;
+        analyseurLogsConflits.ajouterLignesLog({
+            LigneLog{"2018-01-01T01:00:00Z", pointeursUtilisateurs[0], pointeursFilms[0]},
+            LigneLog{"2018-01-01T02:00:00Z", pointeursUtilisateurs[0], autreFilm1},
+            LigneLog{"2018-01-01T03:00:00Z", pointeursUtilisateurs[1], autreFilm1},
+            LigneLog{"2018-01-01T04:00:00Z", pointeursUtilisateurs[1], autreFilm2},
+            LigneLog{"2018-01-01T05:00:00Z", pointeursUtilisateurs[1], pointeursFilms[1]},
+        });
+        std::vector<std::pair<const Film*, int>> filmsPlusPopulairesConflits =
+            analyseurLogsConflits.getNFilmsPlusPopulaires(1);
+        tests.push_back(autreFilm1->indice == pointeursFilms[0]->indice &&
+                        analyseurLogsConflits.getNombreVuesFilm(pointeursFilms[0]) == 1 &&
+                        analyseurLogsConflits.getNombreVuesFilm(autreFilm1) == 2 &&
+                        analyseurLogsConflits.getNombreVuesFilm(autreFilm2) == 1 &&
+                        analyseurLogsConflits.getNombreVuesFilm(pointeursFilms[2]) == 0 &&
+                        analyseurLogsConflits.getFilmPlusPopulaire() == autreFilm1 &&
+                        filmsPlusPopulairesConflits.size() == 1 && filmsPlusPopulairesConflits[0].first == autreFilm1 &&
+                        analyseurLogsConflits.getLigneLog(1).film == autreFilm1 &&
+                        analyseurLogsConflits.getLigneLog(4).film == pointeursFilms[1]);
+        afficherResultatTest(14, "AnalyseurLogs et identifiants denses en conflit", tests.back());
+
+        // Test 15
+        std::int64_t debutIntervalle;
+        std::int64_t finIntervalle;
+        convertirHorodatage("2018-01-01T01:00:00Z", debutIntervalle);
+        convertirHorodatage("2018-01-01T09:00:00Z", finIntervalle);
+        std::vector<std::pair<const Film*, int>> filmsPlusPopulairesIntervalle =
+            analyseurLogs.getNFilmsPlusPopulaires(2, debutIntervalle, finIntervalle);
+        std::vector<std::pair<const Film*, int>> filmsPlusPopulairesIntervalleAttendus = {
+            std::pair<const Film*, int>(pointeursFilms[8], 3),
+            std::pair<const Film*, int>(pointeursFilms[9], 2),
+        };
+        std::vector<const Film*> filmsVusIntervalle =
+            analyseurLogs.getFilmsVusParUtilisateur(pointeursUtilisateurs[1], debutIntervalle, finIntervalle);
+        std::vector<const Film*> filmsVusIntervalleAttendus = {pointeursFilms[2], pointeursFilms[3], pointeursFilms[4]};
+        std::sort(filmsVusIntervalle.begin(), filmsVusIntervalle.end());
+        std::sort(filmsVusIntervalleAttendus.begin(), filmsVusIntervalleAttendus.end());
+        tests.push_back(
+            analyseurLogs.getNombreVuesFilm(pointeursFilms[4], debutIntervalle, finIntervalle) == 1 &&
+            analyseurLogs.getNombreVuesFilm(pointeursFilms[4], finIntervalle, debutIntervalle) == 0 &&
+            analyseurLogs.getNombreVuesFilm(pointeursFilms[8], debutIntervalle, finIntervalle) == 3 &&
+            analyseurLogs.getNombreVuesFilm(&filmInconnu, debutIntervalle, finIntervalle) == 0 &&
+            filmsPlusPopulairesIntervalle == filmsPlusPopulairesIntervalleAttendus &&
+            analyseurLogs.getNombreVuesPourUtilisateur(pointeursUtilisateurs[1], debutIntervalle, finIntervalle) ==
+                3 &&
+            analyseurLogs.getNombreVuesPourUtilisateur(pointeursUtilisateurs[3], debutIntervalle, finIntervalle) ==
+                1 &&
+            filmsVusIntervalle == filmsVusIntervalleAttendus &&
+            analyseurLogsVide.getNFilmsPlusPopulaires(3, debutIntervalle, finIntervalle).empty());
+        afficherResultatTest(15, "AnalyseurLogs statistiques sur un intervalle", tests.back());
+
+        // Test 16
+        std::vector<const Film*> filmsVusOrdonnes = analyseurLogs.getFilmsVusParUtilisateur(pointeursUtilisateurs[3]);
+        std::vector<const Film*> filmsVusOrdonnesAttendus = {
+            pointeursFilms[4],
+            pointeursFilms[5],
+            pointeursFilms[6],
+            pointeursFilms[7],
+            pointeursFilms[8],
+        };
+        int nombreVuesAvantAjout = analyseurLogs.getNombreVuesPourUtilisateur(pointeursUtilisateurs[3]);
+        AnalyseurLogs copieAnalyseurLogs = analyseurLogs;
+        copieAnalyseurLogs.ajouterLigneLog(
+            LigneLog{"2017-01-01T00:00:00Z", pointeursUtilisateurs[3], pointeursFilms[0]});
+        copieAnalyseurLogs.ajouterLigneLog(
+            LigneLog{"2021-01-01T00:00:00Z", pointeursUtilisateurs[3], pointeursFilms[5]});
+        std::vector<const Film*> filmsVusApresAjout =
+            copieAnalyseurLogs.getFilmsVusParUtilisateur(pointeursUtilisateurs[3]);
+        filmsVusOrdonnesAttendus.insert(filmsVusOrdonnesAttendus.begin(), pointeursFilms[0]);
+        tests.push_back(filmsVusOrdonnes == std::vector<const Film*>(std::next(filmsVusOrdonnesAttendus.begin()),
+                                                                     filmsVusOrdonnesAttendus.end()) &&
+                        filmsVusApresAjout == filmsVusOrdonnesAttendus && nombreVuesAvantAjout == 7 &&
+                        copieAnalyseurLogs.getNombreVuesPourUtilisateur(pointeursUtilisateurs[3]) == 9 &&
+                        analyseurLogs.getNombreVuesPourUtilisateur(pointeursUtilisateurs[3]) == 7);
+        afficherResultatTest(16, "AnalyseurLogs index par utilisateur", tests.back());
+
+        // Test 17
+        AnalyseurLogs analyseurLogsClassement;
+        std::array<int, nombreFilms> vuesAttendues{};
+        bool classementCoherent = true;
+        for (std::size_t i = 0; i < 300 && classementCoherent; i++)
+        {
+            std::size_t indiceFilm = (i * i + 3 * i) % 7 + (i % 11 == 0 ? 3 : 0);
+            vuesAttendues[indiceFilm]++;
+            analyseurLogsClassement.ajouterLigneLog(LigneLog{
+                "2018-01-01T00:00:00Z", pointeursUtilisateurs[i % nombreUtilisateurs], pointeursFilms[indiceFilm]});
+
+            std::vector<std::pair<const Film*, int>> classement =
+                analyseurLogsClassement.getNFilmsPlusPopulaires(nombreFilms);
+            auto nombreFilmsVus = static_cast<std::size_t>(
+                std::count_if(vuesAttendues.begin(), vuesAttendues.end(), [](int vues) { return vues > 0; }));
+            const Film* filmPlusPopulaire = analyseurLogsClassement.getFilmPlusPopulaire();
+            classementCoherent =
+                classement.size() == nombreFilmsVus &&
+                classement.front().second == *std::max_element(vuesAttendues.begin(), vuesAttendues.end()) &&
+                analyseurLogsClassement.getNombreVuesFilm(filmPlusPopulaire) == classement.front().second;
+            for (std::size_t j = 0; classementCoherent && j < classement.size(); j++)
+            {
+                classementCoherent =
+                    classement[j].second == analyseurLogsClassement.getNombreVuesFilm(classement[j].first) &&
+                    (j == 0 || classement[j - 1].second >= classement[j].second);
+            }
+        }
+        tests.push_back(classementCoherent && analyseurLogsClassement.getNFilmsPlusPopulaires(0).empty());
+        afficherResultatTest(17, "AnalyseurLogs classement de popularité", tests.back());
+
+        // Test 18
+        AnalyseurLogs analyseurLogsTendances;
+        static constexpr std::int64_t dureeFenetre = 3600;
+        std::int64_t debutTendances;
+        convertirHorodatage("2018-01-01T00:00:00Z", debutTendances);
+        auto ajouterVueTendances = [&](std::int64_t timestamp, std::size_t indiceFilm)
+        {
+            analyseurLogsTendances.ajouterLigneLog(LigneLog{formaterHorodatage(timestamp), pointeursUtilisateurs[0],
+                                                            pointeursFilms[indiceFilm]});
+        };
+        ajouterVueTendances(debutTendances, 1);
+        ajouterVueTendances(debutTendances + 4000, 2);
+        bool tendancesValides = !analyseurLogsTendances.activerTendances(0) &&
+                                analyseurLogsTendances.getNFilmsTendance(nombreFilms).empty() &&
+                                analyseurLogsTendances.activerTendances(dureeFenetre) &&
+                                analyseurLogsTendances.getFilmTendance() == pointeursFilms[2] &&
+                                analyseurLogsTendances.getNFilmsTendance(nombreFilms).size() == 1;
+        // Les films 2 et 3 sortent de la fenêtre puis un nouveau film y entre
+        ajouterVueTendances(debutTendances + 4000, 3);
+        ajouterVueTendances(debutTendances + 8000, 4);
+        ajouterVueTendances(debutTendances + 8000, 5);
+        ajouterVueTendances(debutTendances + 8000, 5);
+        std::vector<std::pair<const Film*, int>> filmsTendanceAttendus = {
+            std::pair<const Film*, int>(pointeursFilms[5], 2),
+            std::pair<const Film*, int>(pointeursFilms[4], 1),
+        };
+        tendancesValides = tendancesValides &&
+                           analyseurLogsTendances.getNFilmsTendance(nombreFilms) == filmsTendanceAttendus;
+        std::int64_t plusRecent = debutTendances + 8000;
+        for (std::size_t i = 0; i < 200 && tendancesValides; i++)
+        {
+            // Des vues surtout récentes, quelques-unes en retard et parfois déjà hors de la fenêtre
+            std::int64_t timestamp = debutTendances + 8000 + static_cast<std::int64_t>(i * 97 % 50 * 60);
+            if (i % 13 == 0)
+            {
+                timestamp -= 5000;
+            }
+            plusRecent = std::max(plusRecent, timestamp);
+            ajouterVueTendances(timestamp, (i * i + i) % 7);
+
+            std::vector<std::pair<const Film*, int>> tendances =
+                analyseurLogsTendances.getNFilmsTendance(nombreFilms);
+            std::vector<std::pair<const Film*, int>> attendus = analyseurLogsTendances.getNFilmsPlusPopulaires(
+                nombreFilms, plusRecent - dureeFenetre + 1, plusRecent + 1);
+            std::sort(tendances.begin(), tendances.end());
+            std::sort(attendus.begin(), attendus.end());
+            tendancesValides = tendances == attendus;
+        }
+        analyseurLogsTendances.desactiverTendances();
+        tests.push_back(tendancesValides && analyseurLogsTendances.getFilmTendance() == nullptr);
+        afficherResultatTest(18, "AnalyseurLogs tendances glissantes", tests.back());
+
+        // Test 19
+        static constexpr std::size_t nombreFilmsZipf = 500;
+        static constexpr std::size_t nombreVuesZipf = 20'000;
+        static constexpr double erreurRelative = 0.01;
+        static constexpr std::size_t nombreFilmsSuivis = 50;
+        std::vector<Film> filmsZipf;
+        std::vector<double> poidsZipf;
+        for (std::size_t i = 0; i < nombreFilmsZipf; i++)
+        {
+            filmsZipf.push_back(Film{"Film", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000,
+                                     static_cast<std::uint32_t>(i)});
+            poidsZipf.push_back(1.0 / std::pow(static_cast<double>(i + 1), 1.1));
+        }
+        AnalyseurLogs analyseurLogsExact;
+        AnalyseurLogs analyseurLogsApproximatif;
+        bool approximatifValide = !analyseurLogsApproximatif.activerModeApproximatif(0.0, 0.01, nombreFilmsSuivis) &&
+                                  !analyseurLogsApproximatif.activerModeApproximatif(0.01, 0.01, 0) &&
+                                  analyseurLogsApproximatif.activerModeApproximatif(erreurRelative, 0.01,
+                                                                                    nombreFilmsSuivis) &&
+                                  analyseurLogsApproximatif.estApproximatif() &&
+                                  !analyseurLogsApproximatif.activerTendances(3600);
+        std::mt19937 generateurZipf(42);
+        std::discrete_distribution<std::size_t> distributionZipf(poidsZipf.begin(), poidsZipf.end());
+        std::vector<LigneLog> lignesZipf;
+        for (std::size_t i = 0; i < nombreVuesZipf; i++)
+        {
+            lignesZipf.push_back(
+                LigneLog{"2018-01-01T00:00:00Z", pointeursUtilisateurs[i % nombreUtilisateurs],
+                         &filmsZipf[distributionZipf(generateurZipf)]});
+        }
+        analyseurLogsExact.ajouterLignesLog(lignesZipf);
+        analyseurLogsApproximatif.ajouterLignesLog(
+            std::vector<LigneLog>(lignesZipf.begin(), lignesZipf.begin() + nombreVuesZipf / 2));
+        for (std::size_t i = nombreVuesZipf / 2; i < nombreVuesZipf; i++)
+        {
+            analyseurLogsApproximatif.ajouterLigneLog(lignesZipf[i]);
+        }
+
+        // Aucune sous-estimation et une erreur d'au plus εN pour chaque film
+        auto erreurMaximale = static_cast<int>(erreurRelative * static_cast<double>(nombreVuesZipf));
+        for (const Film& film : filmsZipf)
+        {
+            int vues = analyseurLogsExact.getNombreVuesFilm(&film);
+            int estimation = analyseurLogsApproximatif.getNombreVuesFilm(&film);
+            approximatifValide = approximatifValide && estimation >= vues && estimation <= vues + erreurMaximale;
+        }
+
+        // Tous les films ayant plus de N/k vues sont retournés, avec une estimation dans les bornes
+        std::vector<std::pair<const Film*, int>> plusPopulairesApproximatifs =
+            analyseurLogsApproximatif.getNFilmsPlusPopulaires(nombreFilmsSuivis);
+        for (const std::pair<const Film*, int>& filmPlusPopulaire :
+             analyseurLogsExact.getNFilmsPlusPopulaires(nombreFilmsZipf))
+        {
+            auto it = std::find_if(plusPopulairesApproximatifs.begin(), plusPopulairesApproximatifs.end(),
+                                   [&](const std::pair<const Film*, int>& paire)
+                                   { return paire.first == filmPlusPopulaire.first; });
+            if (it != plusPopulairesApproximatifs.end())
+            {
+                approximatifValide = approximatifValide && it->second >= filmPlusPopulaire.second &&
+                                     it->second <= filmPlusPopulaire.second + erreurMaximale;
+            }
+            else
+            {
+                approximatifValide = approximatifValide && static_cast<std::size_t>(filmPlusPopulaire.second) <=
+                                                               nombreVuesZipf / nombreFilmsSuivis;
+            }
+        }
+        tests.push_back(approximatifValide &&
+                        analyseurLogsApproximatif.getFilmPlusPopulaire() ==
+                            analyseurLogsExact.getFilmPlusPopulaire() &&
+                        plusPopulairesApproximatifs.size() == nombreFilmsSuivis &&
+                        analyseurLogsApproximatif.getNombreLignesLog() == 0 &&
+                        !Instantane::sauvegarder("instantane_approximatif.bin", GestionnaireUtilisateurs(),
+                                                 GestionnaireFilms(), analyseurLogsApproximatif));
+        afficherResultatTest(19, "AnalyseurLogs mode approximatif", tests.back());
+
+        // Test 20
+        static constexpr std::size_t nombreUtilisateursDistincts = 3000;
+        static constexpr std::size_t nombreVuesDistinctes = 30'000;
+        std::vector<Utilisateur> utilisateursDistincts;
+        for (std::size_t i = 0; i < nombreUtilisateursDistincts; i++)
+        {
+            utilisateursDistincts.push_back(Utilisateur{"id", "Nom", 30, static_cast<Pays>(i % nombrePays),
+                                                        static_cast<std::uint32_t>(i)});
+        }
+        std::uniform_int_distribution<std::size_t> distributionUtilisateurs(0, nombreUtilisateursDistincts - 1);
+        std::vector<LigneLog> lignesDistinctes;
+        std::vector<std::vector<bool>> vusParFilm(nombreFilmsZipf, std::vector<bool>(nombreUtilisateursDistincts));
+        for (std::size_t i = 0; i < nombreVuesDistinctes; i++)
+        {
+            std::size_t indiceUtilisateur = distributionUtilisateurs(generateurZipf);
+            std::size_t indiceFilm = distributionZipf(generateurZipf);
+            vusParFilm[indiceFilm][indiceUtilisateur] = true;
+            lignesDistinctes.push_back(LigneLog{"2018-01-01T00:00:00Z", &utilisateursDistincts[indiceUtilisateur],
+                                                &filmsZipf[indiceFilm]});
+        }
+        AnalyseurLogs analyseurLogsDistincts;
+        AnalyseurLogs premierePartition;
+        AnalyseurLogs secondePartition;
+        analyseurLogsDistincts.ajouterLignesLog(lignesDistinctes);
+        premierePartition.ajouterLignesLog(
+            std::vector<LigneLog>(lignesDistinctes.begin(), lignesDistinctes.begin() + nombreVuesDistinctes / 2));
+        // La seconde partition voit d'abord un film et un utilisateur d'autres gestionnaires qui prennent l'indice 0:
+        // le premier film et le premier utilisateur y reçoivent un autre indice, sans changer les clés des esquisses
+        Film filmAutreGestionnaire{"Autre", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000, 0};
+        Utilisateur utilisateurAutreGestionnaire{"autre", "Autre", 30, utilisateursDistincts[0].pays, 0};
+        std::vector<LigneLog> lignesSecondePartition = {
+            LigneLog{"2018-01-01T00:00:00Z", &utilisateurAutreGestionnaire, &filmAutreGestionnaire}};
+        lignesSecondePartition.insert(lignesSecondePartition.end(),
+                                      lignesDistinctes.begin() + nombreVuesDistinctes / 2, lignesDistinctes.end());
+        secondePartition.ajouterLignesLog(lignesSecondePartition);
+        bool cardinalitesValides = analyseurLogsDistincts.getNombreSpectateursDistincts(&filmsZipf[0]) == 0 &&
+                                   !analyseurLogsDistincts.activerCardinalites(3) &&
+                                   analyseurLogsDistincts.activerCardinalites(10) &&
+                                   premierePartition.activerCardinalites(10) &&
+                                   secondePartition.activerCardinalites(10);
+
+        // Erreur d'au plus trois écarts types (3 × 1,04/√1024 ≈ 10 %) par rapport aux décomptes exacts
+        auto estDansBornes = [](std::int64_t estimation, std::size_t exact)
+        { return std::abs(static_cast<double>(estimation) - static_cast<double>(exact)) <=
+                 0.1 * static_cast<double>(exact) + 2.0; };
+        for (std::size_t i = 0; i < nombreFilmsZipf; i++)
+        {
+            auto spectateurs = static_cast<std::size_t>(std::count(vusParFilm[i].begin(), vusParFilm[i].end(), true));
+            cardinalitesValides = cardinalitesValides &&
+                                  estDansBornes(analyseurLogsDistincts.getNombreSpectateursDistincts(&filmsZipf[i]),
+                                                spectateurs);
+        }
+        std::array<std::size_t, nombrePays> spectateursParPays{};
+        for (std::size_t i = 0; i < nombreUtilisateursDistincts; i++)
+        {
+            int vues = analyseurLogsDistincts.getNombreVuesPourUtilisateur(&utilisateursDistincts[i]);
+            spectateursParPays[i % nombrePays] += vues > 0 ? 1 : 0;
+            cardinalitesValides =
+                cardinalitesValides &&
+                estDansBornes(analyseurLogsDistincts.getNombreFilmsDistincts(&utilisateursDistincts[i]),
+                              analyseurLogsDistincts.getFilmsVusParUtilisateur(&utilisateursDistincts[i]).size());
+        }
+        for (std::size_t i = 0; i < nombrePays; i++)
+        {
+            cardinalitesValides =
+                cardinalitesValides &&
+                estDansBornes(analyseurLogsDistincts.getNombreSpectateursDistincts(static_cast<Pays>(i)),
+                              spectateursParPays[i]);
+        }
+
+        // La fusion des esquisses de deux partitions donne l'esquisse du log complet
+        HyperLogLog spectateursFusionnes = *premierePartition.getEsquisseSpectateurs(&filmsZipf[0]);
+        HyperLogLog spectateursPaysFusionnes = *premierePartition.getEsquisseSpectateurs(Pays::Canada);
+        tests.push_back(cardinalitesValides &&
+                        spectateursFusionnes.fusionner(*secondePartition.getEsquisseSpectateurs(&filmsZipf[0])) &&
+                        spectateursFusionnes.estimer() ==
+                            analyseurLogsDistincts.getEsquisseSpectateurs(&filmsZipf[0])->estimer() &&
+                        spectateursPaysFusionnes.fusionner(*secondePartition.getEsquisseSpectateurs(Pays::Canada)) &&
+                        spectateursPaysFusionnes.estimer() ==
+                            analyseurLogsDistincts.getEsquisseSpectateurs(Pays::Canada)->estimer() &&
+                        !spectateursFusionnes.fusionner(HyperLogLog(12)) &&
+                        analyseurLogsDistincts.getEsquisseSpectateurs(static_cast<Pays>(nombrePays)) == nullptr);
+        afficherResultatTest(20, "AnalyseurLogs cardinalités HyperLogLog", tests.back());
+
+        // Test 21
+        static constexpr std::size_t nombreRealisateurs = 7;
+        GestionnaireFilms gestionnaireRealisateurs;
+        for (std::size_t i = 0; i < 60; i++)
+        {
+            ChaineInternee realisateur("Cinéaste " + std::to_string(i % nombreRealisateurs));
+            gestionnaireRealisateurs.ajouterFilm(
+                Film{"Film " + std::to_string(i), Film::Genre::Drame, Pays::Canada, realisateur, 2000});
+        }
+        std::uniform_int_distribution<std::size_t> distributionFilmsRealisateurs(0, 59);
+        std::vector<LigneLog> lignesRealisateurs;
+        std::array<int, nombreRealisateurs> vuesRealisateursAttendues{};
+        for (std::size_t i = 0; i < 5000; i++)
+        {
+            std::size_t indiceFilm = distributionFilmsRealisateurs(generateurZipf) % (i < 2500 ? 60 : 20);
+            lignesRealisateurs.push_back(
+                LigneLog{"2018-01-01T00:00:00Z", pointeursUtilisateurs[i % nombreUtilisateurs],
+                         gestionnaireRealisateurs.getFilmParNom("Film " + std::to_string(indiceFilm))});
+            vuesRealisateursAttendues[indiceFilm % nombreRealisateurs]++;
+        }
+        AnalyseurLogs analyseurLogsRealisateurs;
+        analyseurLogsRealisateurs.ajouterLignesLog(lignesRealisateurs);
+        std::vector<std::pair<ChaineInternee, int>> realisateursPlusPop =
+            analyseurLogsRealisateurs.getNRealisateursPlusPopulaires(3);
+        bool realisateursValides =
+            analyseurLogsRealisateurs.getNombreVuesRealisateur("Inconnu", gestionnaireRealisateurs) == 0 &&
+            realisateursPlusPop.size() == 3 &&
+            analyseurLogsRealisateurs.getNRealisateursPlusPopulaires(10).size() == nombreRealisateurs;
+        std::array<int, nombreRealisateurs> vuesTriees = vuesRealisateursAttendues;
+        std::sort(vuesTriees.begin(), vuesTriees.end(), std::greater<int>());
+        for (std::size_t i = 0; i < nombreRealisateurs; i++)
+        {
+            std::string realisateur = "Cinéaste " + std::to_string(i);
+            realisateursValides =
+                realisateursValides &&
+                analyseurLogsRealisateurs.getNombreVuesRealisateur(realisateur, gestionnaireRealisateurs) ==
+                    vuesRealisateursAttendues[i] &&
+                (i >= 3 || realisateursPlusPop[i].second == vuesTriees[i]);
+        }
+        for (const auto& [realisateur, vues] : realisateursPlusPop)
+        {
+            realisateursValides =
+                realisateursValides &&
+                vues == analyseurLogsRealisateurs.getNombreVuesRealisateur(realisateur.get(), gestionnaireRealisateurs);
+        }
+        tests.push_back(realisateursValides);
+        afficherResultatTest(21, "AnalyseurLogs vues par réalisateur", tests.back());
+
+        // Test 22
+        static constexpr std::size_t nombreProducteurs = 4;
+        std::array<std::vector<LigneLog>, nombreProducteurs> lignesProducteurs;
+        std::vector<LigneLog> toutesLignesProducteurs;
+        std::uniform_int_distribution<std::int64_t> distributionSecondes(1514764800, 1514764800 + 86400);
+        for (auto& lignesProducteur : lignesProducteurs)
+        {
+            for (std::size_t i = 0; i < 3000; i++)
+            {
+                lignesProducteur.push_back(LigneLog{formaterHorodatage(distributionSecondes(generateurZipf)),
+                                                    pointeursUtilisateurs[generateurZipf() % nombreUtilisateurs],
+                                                    pointeursFilms[generateurZipf() % nombreFilms]});
+            }
+            toutesLignesProducteurs.insert(toutesLignesProducteurs.end(), lignesProducteur.begin(),
+                                           lignesProducteur.end());
+        }
+        AnalyseurLogs analyseurLogsIngestion;
+        bool ingestionValide = true;
+        {
+            IngestionLogs ingestion(analyseurLogsIngestion, 2, std::chrono::milliseconds(1));
+            std::vector<std::thread> producteurs;
+            for (const auto& lignesProducteur : lignesProducteurs)
+            {
+                producteurs.emplace_back(
+                    [&ingestion, &lignesProducteur]()
+                    {
+                        for (const LigneLog& ligneLog : lignesProducteur)
+                        {
+                            ingestion.ajouterLigneLog(ligneLog);
+                        }
+                    });
+            }
+            for (int i = 0; i < 50; i++)
+            {
+                ingestionValide = ingestionValide && ingestion.consulter([](const AnalyseurLogs& analyseur)
+                                                                         { return analyseur.getNombreLignesLog(); }) <=
+                                                         toutesLignesProducteurs.size();
+            }
+            for (std::thread& producteur : producteurs)
+            {
+                producteur.join();
+            }
+            ingestionValide = ingestionValide && !ingestion.ajouterLigneLog(LigneLog{"oops", nullptr, nullptr}) &&
+                              ingestion.getNombreLignesRecues() == toutesLignesProducteurs.size();
+            ingestion.vider();
+            ingestionValide = ingestionValide && ingestion.getNombreLignesIngerees() == toutesLignesProducteurs.size();
+        }
+        AnalyseurLogs analyseurLogsReference;
+        analyseurLogsReference.ajouterLignesLog(toutesLignesProducteurs);
+        ingestionValide = ingestionValide &&
+                          analyseurLogsIngestion.getNombreLignesLog() == toutesLignesProducteurs.size();
+        for (std::size_t i = 1; i < analyseurLogsIngestion.getNombreLignesLog() && ingestionValide; i++)
+        {
+            ingestionValide = analyseurLogsIngestion.getLigneLog(i - 1).timestamp <=
+                              analyseurLogsIngestion.getLigneLog(i).timestamp;
+        }
+        for (std::size_t i = 0; i < nombreFilms; i++)
+        {
+            ingestionValide = ingestionValide && analyseurLogsIngestion.getNombreVuesFilm(pointeursFilms[i]) ==
+                                                     analyseurLogsReference.getNombreVuesFilm(pointeursFilms[i]);
+        }
+        for (std::size_t i = 0; i < nombreUtilisateurs; i++)
+        {
+            ingestionValide =
+                ingestionValide &&
+                analyseurLogsIngestion.getNombreVuesPourUtilisateur(pointeursUtilisateurs[i]) ==
+                    analyseurLogsReference.getNombreVuesPourUtilisateur(pointeursUtilisateurs[i]) &&
+                analyseurLogsIngestion.getFilmsVusParUtilisateur(pointeursUtilisateurs[i]).size() ==
+                    analyseurLogsReference.getFilmsVusParUtilisateur(pointeursUtilisateurs[i]).size();
+        }
+        tests.push_back(ingestionValide);
+        afficherResultatTest(22, "IngestionLogs producteurs concurrents", tests.back());
+
+        // Test 23
+        // Un enregistrement invalide dont la somme de contrôle est recalculée doit être rejeté sans que les logs qui
+        // le référencent ne soient décodés
+        static const std::string nomFichierCorrompu = "instantane_corrompu.bin";
+        GestionnaireFilms filmsCorrompus;
+        GestionnaireUtilisateurs utilisateursCorrompus;
+        AnalyseurLogs logsCorrompus;
+        filmsCorrompus.ajouterFilm(Film{"A", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        filmsCorrompus.ajouterFilm(Film{"B", Film::Genre::Drame, Pays::Canada, ChaineInternee("Réalisateur"), 2000});
+        utilisateursCorrompus.ajouterUtilisateur(Utilisateur{"u@email.com", "U", 30, Pays::Canada});
+        logsCorrompus.ajouterLigneLog(LigneLog{"2018-01-01T00:00:00Z",
+                                               utilisateursCorrompus.getUtilisateurParId("u@email.com"),
+                                               filmsCorrompus.getFilmParNom("B")});
+        Instantane::sauvegarder(nomFichierCorrompu, utilisateursCorrompus, filmsCorrompus, logsCorrompus);
+        std::string contenuInstantane;
+        {
+            std::ifstream fichierInstantane(nomFichierCorrompu, std::ios::binary);
+            std::ostringstream octets;
+            octets << fichierInstantane.rdbuf();
+            contenuInstantane = octets.str();
+        }
+        // Remplace l'octet suivant une chaîne encodée, soit le genre d'un film ou le pays d'un utilisateur, puis
+        // recalcule la somme FNV-1a des données qui suivent l'en-tête de 32 octets
+        auto chargerCorrompu = [&](const std::string& chaine, std::size_t decalage, char octet)
+        {
+            std::string contenu = contenuInstantane;
+            std::string chaineEncodee = std::string(1, static_cast<char>(chaine.size())) + std::string(3, '\0') + chaine;
+            contenu[contenu.find(chaineEncodee, 32) + chaineEncodee.size() + decalage] = octet;
+            std::uint64_t somme = 14695981039346656037ull;
+            for (std::size_t i = 32; i < contenu.size(); i++)
+            {
+                somme ^= static_cast<unsigned char>(contenu[i]);
+                somme *= 1099511628211ull;
+            }
+            for (std::size_t i = 0; i < 8; i++)
+            {
+                contenu[24 + i] = static_cast<char>(somme >> (8 * i));
+            }
+            std::ofstream(nomFichierCorrompu, std::ios::binary | std::ios::trunc) << contenu;
+            GestionnaireFilms filmsRestaures;
+            GestionnaireUtilisateurs utilisateursRestaures;
+            AnalyseurLogs logsRestaures;
+            return Instantane::charger(nomFichierCorrompu, utilisateursRestaures, filmsRestaures, logsRestaures);
+        };
+        bool chargementIntact = chargerCorrompu("B", 0, static_cast<char>(Film::Genre::Drame));
+        bool chargementGenre = chargerCorrompu("B", 0, static_cast<char>(200));
+        bool chargementPays = chargerCorrompu("U", 4, static_cast<char>(nombrePays));
+        std::remove(nomFichierCorrompu.c_str());
+        tests.push_back(chargementIntact && !chargementGenre && !chargementPays);
+        afficherResultatTest(23, "Instantane::charger enregistrement corrompu", tests.back());
+
         int nombreTestsReussis = static_cast<int>(std::count(tests.begin(), tests.end(), true));
         double totalPointsSection =
             static_cast<double>(nombreTestsReussis) / static_cast<double>(tests.size()) * maxPointsSection;
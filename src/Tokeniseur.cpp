@@ -0,0 +1,158 @@
+/// Découpage sans copie des lignes des fichiers de données.
+/// \author Adam Burhan, Jean-Sébastien Dulong-Grégoire
+/// \date 2026-10-17
+
+#include "Tokeniseur.h"
+#include <charconv>
+
+namespace
+{
+    /// Indique si un caractère est un espace blanc au sens de std::isspace dans la locale "C".
+    /// \param caractere    Le caractère à vérifier.
+    /// \return             True si le caractère sépare deux mots.
+    bool estEspace(char caractere)
+    {
+        return caractere == ' ' || caractere == '\t' || caractere == '\n' || caractere == '\v' || caractere == '\f' ||
+               caractere == '\r';
+    }
+
+    /// Retire les espaces blancs au début de la vue, comme le fait std::ws.
+    /// \param ligne    La vue à modifier.
+    void sauterEspaces(std::string_view& ligne)
+    {
+        std::size_t position = 0;
+        while (position < ligne.size() && estEspace(ligne[position]))
+        {
+            position++;
+        }
+        ligne.remove_prefix(position);
+    }
+} // namespace
+
+namespace Tokeniseur
+{
+    /// Extrait la prochaine ligne du contenu avec la même sémantique que std::getline.
+    /// \param contenu  Le contenu restant à découper, avancé après le '\n' de la ligne extraite.
+    /// \param ligne    La ligne extraite, sans son '\n'.
+    /// \return         False s'il ne reste plus aucune ligne à lire.
+    bool lireLigne(std::string_view& contenu, std::string_view& ligne)
+    {
+        if (contenu.empty())
+        {
+            return false;
+        }
+        std::size_t finLigne = contenu.find('\n');
+        if (finLigne == std::string_view::npos)
+        {
+            ligne = contenu;
+            contenu = std::string_view();
+        }
+        else
+        {
+            ligne = contenu.substr(0, finLigne);
+            contenu.remove_prefix(finLigne + 1);
+        }
+        return true;
+    }
+
+    /// Extrait le prochain mot délimité par des espaces blancs, comme operator>> vers un std::string.
+    /// \param ligne    La ligne restante, avancée après le mot extrait.
+    /// \param mot      Le mot extrait, qui pointe dans la ligne.
+    /// \return         False si la ligne ne contient plus de mot.
+    bool lireMot(std::string_view& ligne, std::string_view& mot)
+    {
+        sauterEspaces(ligne);
+        if (ligne.empty())
+        {
+            return false;
+        }
+        std::size_t finMot = 1;
+        while (finMot < ligne.size() && !estEspace(ligne[finMot]))
+        {
+            finMot++;
+        }
+        mot = ligne.substr(0, finMot);
+        ligne.remove_prefix(finMot);
+        return true;
+    }
+
+    /// Extrait une valeur entre guillemets avec la même sémantique que std::quoted (délimiteur '"', échappement
+    /// '\\'). Si la valeur ne commence pas par un guillemet, elle est extraite comme un mot.
+    /// \param ligne    La ligne restante, avancée après la valeur extraite.
+    /// \param valeur   La valeur extraite. Elle pointe dans la ligne, sauf si elle contient des échappements, auquel
+    ///                 cas elle pointe dans le tampon.
+    /// \param tampon   Tampon réutilisé pour reconstruire les valeurs contenant des échappements.
+    /// \return         False si la ligne ne contient plus de valeur ou si le guillemet fermant est manquant.
+    bool lireGuillemets(std::string_view& ligne, std::string_view& valeur, std::string& tampon)
+    {
+        sauterEspaces(ligne);
+        if (ligne.empty())
+        {
+            return false;
+        }
+        if (ligne.front() != '"')
+        {
+            return lireMot(ligne, valeur);
+        }
+
+        bool contientEchappement = false;
+        for (std::size_t position = 1; position < ligne.size(); position++)
+        {
+            if (ligne[position] == '\\')
+            {
+                contientEchappement = true;
+                position++;
+            }
+            else if (ligne[position] == '"')
+            {
+                std::string_view brut = ligne.substr(1, position - 1);
+                ligne.remove_prefix(position + 1);
+                if (!contientEchappement)
+                {
+                    valeur = brut;
+                    return true;
+                }
+
+                tampon.clear();
+                for (std::size_t i = 0; i < brut.size(); i++)
+                {
+                    if (brut[i] == '\\')
+                    {
+                        i++;
+                    }
+                    tampon.push_back(brut[i]);
+                }
+                valeur = tampon;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Extrait un entier décimal signé, comme operator>> vers un int. La lecture s'arrête au premier caractère qui
+    /// n'est pas un chiffre et échoue si la valeur dépasse les bornes d'un int.
+    /// \param ligne    La ligne restante, avancée après l'entier extrait.
+    /// \param valeur   L'entier extrait.
+    /// \return         False si la ligne ne commence pas par un entier valide.
+    bool lireEntier(std::string_view& ligne, int& valeur)
+    {
+        sauterEspaces(ligne);
+        std::size_t debut = 0;
+        if (!ligne.empty() && ligne.front() == '+') // std::from_chars ne reconnaît que le signe '-'
+        {
+            debut = 1;
+            if (ligne.size() < 2 || ligne[1] < '0' || ligne[1] > '9')
+            {
+                return false;
+            }
+        }
+        const char* fin = ligne.data() + ligne.size();
+        auto [position, erreur] = std::from_chars(ligne.data() + debut, fin, valeur);
+        if (erreur != std::errc())
+        {
+            return false;
+        }
+        ligne.remove_prefix(static_cast<std::size_t>(position - ligne.data()));
+        return true;
+    }
+} // namespace Tokeniseur
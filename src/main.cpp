@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include "AnalyseurLogs.h"
+#include "Benchmarks.h"
 #include "GestionnaireFilms.h"
 #include "GestionnaireUtilisateurs.h"
 #include "Tests.h"
@@ -17,6 +18,10 @@ int main()
 
     Tests::testAll();
 
+#if BENCHMARKS_ACTIFS
+    Benchmarks::benchmarkAll();
+#endif
+
     // Écrivez le code pour le bonus ici
 
     //affichage gestionnaire d'utilisateurs
@@ -26,7 +31,7 @@ int main()
 
     GestionnaireFilms gestFilms;
     gestFilms.chargerDepuisFichier("films.txt");
-    std::vector<const Film*> filmsAventure = gestFilms.getFilmsParGenre(Film::Genre::Aventure);
+    VueFilms filmsAventure = gestFilms.getFilmsParGenre(Film::Genre::Aventure);
     std::cout << "Films d'aventure:\n";
     for (const auto& film : filmsAventure)
     {